@@ -26,6 +26,10 @@
 #include "logic/status/StatusChecker.h"
 
 #include "logic/net/HttpMetaCache.h"
+#include "logic/net/HostScheduler.h"
+#include "logic/net/DownloadCoordinator.h"
+#include "logic/net/BandwidthBudget.h"
+#include "logic/net/NetStats.h"
 #include "logic/net/URLConstants.h"
 
 #include "logic/java/JavaUtils.h"
@@ -80,6 +84,24 @@ MultiMC::MultiMC(int &argc, char **argv, bool test_mode) : QApplication(argc, ar
 		parser.addShortOpt("dir", 'd');
 		parser.addDocumentation("dir", "use the supplied directory as MultiMC root instead of "
 									   "the binary location (use '.' for current)");
+		// --warm-cache
+		parser.addSwitch("warm-cache");
+		parser.addDocumentation("warm-cache", "download everything the instances need to launch, "
+											  "without showing a window, and exit. Add "
+											  "'-platform offscreen' when there is no display.");
+		// --collect-cache
+		parser.addSwitch("collect-cache");
+		parser.addDocumentation("collect-cache", "remove files no instance uses from the caches "
+												 "that are over their size limit, and exit.");
+		// --scan-assets
+		parser.addSwitch("scan-assets");
+		parser.addDocumentation("scan-assets", "check the shared asset objects against the "
+											   "asset indexes, download the missing and damaged "
+											   "ones again, and exit.");
+		// --dry-run
+		parser.addSwitch("dry-run");
+		parser.addDocumentation("dry-run", "with --collect-cache, only report what would be "
+										   "removed. With --scan-assets, don't repair anything.");
 
 		// parse the arguments
 		try
@@ -111,6 +133,11 @@ MultiMC::MultiMC(int &argc, char **argv, bool test_mode) : QApplication(argc, ar
 			m_status = MultiMC::Succeeded;
 			return;
 		}
+
+		m_warmCache = args["warm-cache"].toBool();
+		m_collectCache = args["collect-cache"].toBool();
+		m_scanAssets = args["scan-assets"].toBool();
+		m_dryRun = args["dry-run"].toBool();
 	}
 	origcwdPath = QDir::currentPath();
 	binPath = applicationDirPath();
@@ -237,6 +264,18 @@ MultiMC::MultiMC(int &argc, char **argv, bool test_mode) : QApplication(argc, ar
 	// create the global network manager
 	m_qnam.reset(new QNetworkAccessManager(this));
 
+	// and the per-host download scheduler
+	m_hostScheduler.reset(new HostScheduler());
+
+	// and the bandwidth budget shared by all downloads
+	m_bandwidthBudget.reset(new BandwidthBudget());
+
+	// and the collector of download timings
+	m_netStats.reset(new NetStats());
+
+	// and the thing that keeps jobs from downloading the same file twice
+	m_downloadCoordinator.reset(new DownloadCoordinator());
+
 	m_translationChecker->downloadTranslations();
 
 	// init proxy settings
@@ -508,6 +547,25 @@ void MultiMC::initGlobalSettings(bool test_mode)
 	m_settings->registerSetting({"ProxyUser", "ProxyUsername"}, "");
 	m_settings->registerSetting({"ProxyPass", "ProxyPassword"}, "");
 
+	// Download concurrency
+	m_settings->registerSetting("NetHostAdaptiveConcurrency", true);
+	m_settings->registerSetting("NetHostInitialConcurrency", 6);
+	m_settings->registerSetting("NetHostMinConcurrency", 1);
+	m_settings->registerSetting("NetHostMaxConcurrency", 16);
+	// Download rate limit in KiB/s, 0 for unlimited
+	m_settings->registerSetting("NetRateLimit", 0);
+	// Write the download timings to net-timing.json
+	m_settings->registerSetting("NetTimingDump", false);
+	// What the Forge mirror probes found out so far, as JSON
+	m_settings->registerSetting("ForgeMirrorRanking", QString());
+
+	// Cache size limits in MiB, 0 for unlimited. Enforced by --collect-cache
+	m_settings->registerSetting("CacheLimitLibraries", 0);
+	m_settings->registerSetting("CacheLimitVersions", 0);
+	m_settings->registerSetting("CacheLimitAssets", 0);
+	// Store the downloaded version lists gzip compressed
+	m_settings->registerSetting("CompressMetadataCache", false);
+
 	// Memory
 	m_settings->registerSetting({"MinMemAlloc", "MinMemoryAlloc"}, 512);
 	m_settings->registerSetting({"MaxMemAlloc", "MaxMemoryAlloc"}, 1024);
@@ -548,12 +606,13 @@ void MultiMC::initHttpMetaCache()
 	m_metacache->addBase("asset_objects", QDir("assets/objects").absolutePath());
 	m_metacache->addBase("versions", QDir("versions").absolutePath());
 	m_metacache->addBase("libraries", QDir("libraries").absolutePath());
-	m_metacache->addBase("minecraftforge", QDir("mods/minecraftforge").absolutePath());
+	m_metacache->addBase("minecraftforge", QDir("mods/minecraftforge").absolutePath(), true);
 	m_metacache->addBase("fmllibs", QDir("mods/minecraftforge/libs").absolutePath());
-	m_metacache->addBase("liteloader", QDir("mods/liteloader").absolutePath());
+	m_metacache->addBase("liteloader", QDir("mods/liteloader").absolutePath(), true);
 	m_metacache->addBase("skins", QDir("accounts/skins").absolutePath());
-	m_metacache->addBase("root", QDir(root()).absolutePath());
+	m_metacache->addBase("root", QDir(root()).absolutePath(), true);
 	m_metacache->addBase("translations", QDir(staticData() + "/translations").absolutePath());
+	m_metacache->setCompressMetadata(m_settings->get("CompressMetadataCache").toBool());
 	m_metacache->Load();
 }
 
@@ -9,6 +9,10 @@
 class MinecraftVersionList;
 class LWJGLVersionList;
 class HttpMetaCache;
+class HostScheduler;
+class DownloadCoordinator;
+class BandwidthBudget;
+class NetStats;
 class SettingsObject;
 class InstanceList;
 class MojangAccountList;
@@ -77,6 +81,30 @@ public:
 		return m_status;
 	}
 
+	/// was MultiMC started with --warm-cache?
+	bool warmCacheMode() const
+	{
+		return m_warmCache;
+	}
+
+	/// was MultiMC started with --collect-cache?
+	bool collectCacheMode() const
+	{
+		return m_collectCache;
+	}
+
+	/// was MultiMC started with --scan-assets?
+	bool scanAssetsMode() const
+	{
+		return m_scanAssets;
+	}
+
+	/// was MultiMC started with --dry-run?
+	bool dryRunMode() const
+	{
+		return m_dryRun;
+	}
+
 	std::shared_ptr<QNetworkAccessManager> qnam()
 	{
 		return m_qnam;
@@ -87,6 +115,26 @@ public:
 		return m_metacache;
 	}
 
+	std::shared_ptr<HostScheduler> hostScheduler()
+	{
+		return m_hostScheduler;
+	}
+
+	std::shared_ptr<DownloadCoordinator> downloadCoordinator()
+	{
+		return m_downloadCoordinator;
+	}
+
+	std::shared_ptr<BandwidthBudget> bandwidthBudget()
+	{
+		return m_bandwidthBudget;
+	}
+
+	std::shared_ptr<NetStats> netStats()
+	{
+		return m_netStats;
+	}
+
 	std::shared_ptr<UpdateChecker> updateChecker()
 	{
 		return m_updateChecker;
@@ -198,6 +246,10 @@ private:
 	std::shared_ptr<IconList> m_icons;
 	std::shared_ptr<QNetworkAccessManager> m_qnam;
 	std::shared_ptr<HttpMetaCache> m_metacache;
+	std::shared_ptr<HostScheduler> m_hostScheduler;
+	std::shared_ptr<DownloadCoordinator> m_downloadCoordinator;
+	std::shared_ptr<BandwidthBudget> m_bandwidthBudget;
+	std::shared_ptr<NetStats> m_netStats;
 	std::shared_ptr<LWJGLVersionList> m_lwjgllist;
 	std::shared_ptr<ForgeVersionList> m_forgelist;
 	std::shared_ptr<LiteLoaderVersionList> m_liteloaderlist;
@@ -221,4 +273,8 @@ private:
 	QString origcwdPath;
 
 	Status m_status = MultiMC::Failed;
+	bool m_warmCache = false;
+	bool m_collectCache = false;
+	bool m_scanAssets = false;
+	bool m_dryRun = false;
 };
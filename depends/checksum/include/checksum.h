@@ -0,0 +1,55 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * CRC32 and CRC64 for everything that checks or writes archives: the zip
+ * entries of quazip and the pack200 unpacker, and the xz streams.
+ *
+ * Both use the reflected bit order and the pre- and post-inversion of
+ * zlib and xz. To start a new calculation, pass zero as crc. To continue
+ * one, pass the previously returned value.
+ */
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CRC32 with the polynomial of IEEE-802.3, the same as crc32() of zlib */
+uint32_t checksum_crc32(uint32_t crc, const void *buf, size_t len);
+
+/* CRC64 with the polynomial of ECMA-182, the one used by xz */
+uint64_t checksum_crc64(uint64_t crc, const void *buf, size_t len);
+
+/*
+ * The portable slice-by-8 kernels. The functions above use them for short
+ * buffers, and everywhere the CPU can't do carry-less multiplication.
+ */
+uint32_t checksum_crc32_slice8(uint32_t crc, const void *buf, size_t len);
+uint64_t checksum_crc64_slice8(uint64_t crc, const void *buf, size_t len);
+
+/* non-zero if long buffers are folded with carry-less multiplication */
+int checksum_have_clmul(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,281 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "checksum.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CHECKSUM_CLMUL 1
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#ifndef CHECKSUM_MAKE_TABLES
+#include "checksum_tables.h"
+
+/* buffers shorter than this aren't worth setting up the folding for */
+#define CLMUL_MIN_LENGTH 64
+
+static uint32_t load32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t load64(const uint8_t *p)
+{
+	return (uint64_t)load32(p) | (uint64_t)load32(p + 4) << 32;
+}
+
+/*
+ * The kernels work on the inverted state, so the folding can hand over the
+ * last bytes to them.
+ */
+static uint32_t crc32_slice8(uint32_t crc, const uint8_t *buf, size_t len)
+{
+	while (len != 0 && ((uintptr_t)buf & 7) != 0)
+	{
+		crc = crc32_table[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+		--len;
+	}
+	while (len >= 8)
+	{
+		uint32_t one = crc ^ load32(buf);
+		uint32_t two = load32(buf + 4);
+		crc = crc32_table[7][one & 0xFF] ^ crc32_table[6][(one >> 8) & 0xFF] ^
+			  crc32_table[5][(one >> 16) & 0xFF] ^ crc32_table[4][one >> 24] ^
+			  crc32_table[3][two & 0xFF] ^ crc32_table[2][(two >> 8) & 0xFF] ^
+			  crc32_table[1][(two >> 16) & 0xFF] ^ crc32_table[0][two >> 24];
+		buf += 8;
+		len -= 8;
+	}
+	while (len != 0)
+	{
+		crc = crc32_table[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+		--len;
+	}
+	return crc;
+}
+
+static uint64_t crc64_slice8(uint64_t crc, const uint8_t *buf, size_t len)
+{
+	while (len != 0 && ((uintptr_t)buf & 7) != 0)
+	{
+		crc = crc64_table[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+		--len;
+	}
+	while (len >= 8)
+	{
+		uint64_t v = crc ^ load64(buf);
+		crc = crc64_table[7][v & 0xFF] ^ crc64_table[6][(v >> 8) & 0xFF] ^
+			  crc64_table[5][(v >> 16) & 0xFF] ^ crc64_table[4][(v >> 24) & 0xFF] ^
+			  crc64_table[3][(v >> 32) & 0xFF] ^ crc64_table[2][(v >> 40) & 0xFF] ^
+			  crc64_table[1][(v >> 48) & 0xFF] ^ crc64_table[0][v >> 56];
+		buf += 8;
+		len -= 8;
+	}
+	while (len != 0)
+	{
+		crc = crc64_table[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+		--len;
+	}
+	return crc;
+}
+
+#ifdef CHECKSUM_CLMUL
+/*
+ * Folding with carry-less multiplication, for both widths. The message is
+ * reduced 64 bytes at a time into four 16 byte accumulators, which are then
+ * folded into one. Each fold multiplies the two halves of an accumulator by
+ * x^n mod P for the distance they move, so the message stays the same modulo
+ * the polynomial. What is left goes through the table kernel.
+ *
+ * The constants are bit-reflected, and one power of x lower than the
+ * distance, because the product of two reflected values comes out shifted.
+ */
+struct fold_constants
+{
+	uint64_t k575, k511; /* 64 bytes ahead */
+	uint64_t k191, k127; /* 16 bytes ahead */
+};
+
+static const struct fold_constants crc32_fold = {
+	0x653d982200000000ULL, 0xcad38e8f00000000ULL, 0x65673b4600000000ULL, 0x9ba54c6f00000000ULL};
+
+static const struct fold_constants crc64_fold = {
+	0x6ae3efbb9dd441f3ULL, 0x081f6054a7842df4ULL, 0xe05dd497ca393ae4ULL, 0xdabe95afc7875f40ULL};
+
+__attribute__((target("pclmul,sse2"))) static inline __m128i fold(__m128i x, __m128i k)
+{
+	return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/*
+ * Folds all but the last len % 16 bytes and returns the 16 bytes standing in
+ * for them. The state has to be xored into the first bytes already.
+ */
+__attribute__((target("pclmul,sse2"))) static const uint8_t *
+fold_clmul(const struct fold_constants *c, __m128i x0, const uint8_t *buf, size_t *len,
+		   uint8_t out[16])
+{
+	const __m128i k64 = _mm_set_epi64x((long long)c->k511, (long long)c->k575);
+	const __m128i k16 = _mm_set_epi64x((long long)c->k127, (long long)c->k191);
+	__m128i x1, x2, x3;
+
+	x0 = _mm_xor_si128(x0, _mm_loadu_si128((const __m128i *)buf));
+	x1 = _mm_loadu_si128((const __m128i *)(buf + 16));
+	x2 = _mm_loadu_si128((const __m128i *)(buf + 32));
+	x3 = _mm_loadu_si128((const __m128i *)(buf + 48));
+	buf += 64;
+	*len -= 64;
+
+	while (*len >= 64)
+	{
+		x0 = _mm_xor_si128(fold(x0, k64), _mm_loadu_si128((const __m128i *)buf));
+		x1 = _mm_xor_si128(fold(x1, k64), _mm_loadu_si128((const __m128i *)(buf + 16)));
+		x2 = _mm_xor_si128(fold(x2, k64), _mm_loadu_si128((const __m128i *)(buf + 32)));
+		x3 = _mm_xor_si128(fold(x3, k64), _mm_loadu_si128((const __m128i *)(buf + 48)));
+		buf += 64;
+		*len -= 64;
+	}
+
+	x0 = _mm_xor_si128(fold(x0, k16), x1);
+	x0 = _mm_xor_si128(fold(x0, k16), x2);
+	x0 = _mm_xor_si128(fold(x0, k16), x3);
+	while (*len >= 16)
+	{
+		x0 = _mm_xor_si128(fold(x0, k16), _mm_loadu_si128((const __m128i *)buf));
+		buf += 16;
+		*len -= 16;
+	}
+	_mm_storeu_si128((__m128i *)out, x0);
+	return buf;
+}
+
+__attribute__((target("pclmul,sse2"))) static uint32_t crc32_clmul(uint32_t crc,
+																	const uint8_t *buf,
+																	size_t len)
+{
+	uint8_t folded[16];
+	buf = fold_clmul(&crc32_fold, _mm_cvtsi32_si128((int)crc), buf, &len, folded);
+	crc = crc32_slice8(0, folded, sizeof(folded));
+	return crc32_slice8(crc, buf, len);
+}
+
+__attribute__((target("pclmul,sse2"))) static uint64_t crc64_clmul(uint64_t crc,
+																	const uint8_t *buf,
+																	size_t len)
+{
+	uint8_t folded[16];
+	buf = fold_clmul(&crc64_fold, _mm_cvtsi64_si128((long long)crc), buf, &len, folded);
+	crc = crc64_slice8(0, folded, sizeof(folded));
+	return crc64_slice8(crc, buf, len);
+}
+#endif
+
+int checksum_have_clmul(void)
+{
+#ifdef CHECKSUM_CLMUL
+	return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse2");
+#else
+	return 0;
+#endif
+}
+
+uint32_t checksum_crc32_slice8(uint32_t crc, const void *buf, size_t len)
+{
+	return ~crc32_slice8(~crc, (const uint8_t *)buf, len);
+}
+
+uint64_t checksum_crc64_slice8(uint64_t crc, const void *buf, size_t len)
+{
+	return ~crc64_slice8(~crc, (const uint8_t *)buf, len);
+}
+
+uint32_t checksum_crc32(uint32_t crc, const void *buf, size_t len)
+{
+#ifdef CHECKSUM_CLMUL
+	if (len >= CLMUL_MIN_LENGTH && checksum_have_clmul())
+		return ~crc32_clmul(~crc, (const uint8_t *)buf, len);
+#endif
+	return checksum_crc32_slice8(crc, buf, len);
+}
+
+uint64_t checksum_crc64(uint64_t crc, const void *buf, size_t len)
+{
+#ifdef CHECKSUM_CLMUL
+	if (len >= CLMUL_MIN_LENGTH && checksum_have_clmul())
+		return ~crc64_clmul(~crc, (const uint8_t *)buf, len);
+#endif
+	return checksum_crc64_slice8(crc, buf, len);
+}
+
+#else
+/*
+ * Writes checksum_tables.h. Build this file alone with CHECKSUM_MAKE_TABLES
+ * defined and run it. The first table of each width is the byte-at-a-time
+ * table xz and zlib use, every other one advances the previous by a zero byte.
+ */
+#include <stdio.h>
+
+int main(void)
+{
+	static uint32_t t32[8][256];
+	static uint64_t t64[8][256];
+	int i, j, k;
+
+	for (i = 0; i < 256; ++i)
+	{
+		uint32_t r = (uint32_t)i;
+		uint64_t q = (uint64_t)i;
+		for (j = 0; j < 8; ++j)
+		{
+			r = (r >> 1) ^ (0xEDB88320 & ~((r & 1) - 1));
+			q = (q >> 1) ^ (0xC96C5795D7870F42ULL & ~((q & 1) - 1));
+		}
+		t32[0][i] = r;
+		t64[0][i] = q;
+	}
+	for (k = 1; k < 8; ++k)
+	{
+		for (i = 0; i < 256; ++i)
+		{
+			t32[k][i] = (t32[k - 1][i] >> 8) ^ t32[0][t32[k - 1][i] & 0xFF];
+			t64[k][i] = (t64[k - 1][i] >> 8) ^ t64[0][t64[k - 1][i] & 0xFF];
+		}
+	}
+
+	printf("/* generated by checksum.c with CHECKSUM_MAKE_TABLES, do not edit */\n\n");
+	printf("static const uint32_t crc32_table[8][256] = {");
+	for (k = 0; k < 8; ++k)
+	{
+		printf("%s\n\t{", k ? "," : "");
+		for (i = 0; i < 256; ++i)
+			printf("%s0x%08lxUL", i == 0 ? "" : (i % 6 == 0 ? ",\n\t " : ", "),
+				   (unsigned long)t32[k][i]);
+		printf("}");
+	}
+	printf("};\n\n");
+	printf("static const uint64_t crc64_table[8][256] = {");
+	for (k = 0; k < 8; ++k)
+	{
+		printf("%s\n\t{", k ? "," : "");
+		for (i = 0; i < 256; ++i)
+			printf("%s0x%016llxULL", i == 0 ? "" : (i % 4 == 0 ? ",\n\t " : ", "),
+				   (unsigned long long)t64[k][i]);
+		printf("}");
+	}
+	printf("};\n");
+	return 0;
+}
+#endif
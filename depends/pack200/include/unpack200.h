@@ -25,6 +25,8 @@
 
 #pragma once
 #include <string>
+#include <cstdio>
+#include <stdint.h>
 
 /**
  * @brief Unpack a PACK200 file
@@ -35,3 +37,28 @@
  * @throw std::runtime_error for any error encountered
  */
 void unpack_200(FILE * input, FILE * output);
+
+/**
+ * @brief Reads input for unpack_200_stream
+ *
+ * Blocks until data is available.
+ * @return number of bytes put into buf, at most maxlen. 0 at the end of the input.
+ */
+typedef int64_t (*unpack_200_read_fn)(void *context, void *buf, int64_t maxlen);
+
+/**
+ * @brief Takes output of unpack_200_stream
+ *
+ * @return false if the data couldn't be written. The unpacking is aborted then.
+ */
+typedef bool (*unpack_200_write_fn)(void *context, const void *buf, int64_t len);
+
+/**
+ * @brief Unpack a PACK200 stream, for when the input isn't in a file (yet)
+ *
+ * @param read called for more input, from the calling thread
+ * @param write called with the output JAR, in order, from the calling thread
+ * @param context passed to read and write
+ * @throw std::runtime_error for any error encountered
+ */
+void unpack_200_stream(unpack_200_read_fn read, unpack_200_write_fn write, void *context);
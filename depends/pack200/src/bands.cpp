@@ -181,20 +181,22 @@ int band::getIntTotal()
 		return 0;
 	if (total_memo > 0)
 		return total_memo - 1;
-	int total = getInt();
 	// overflow checks require that none of the addends are <0,
 	// and that the partial sums never overflow (wrap negative)
-	if (total < 0)
-	{
-		unpack_abort("overflow detected");
-	}
-	for (int k = length - 1; k > 0; k--)
+	int total = 0;
+	int values[VALUE_BATCH];
+	for (int k = 0; k < length; k += VALUE_BATCH)
 	{
-		int prev_total = total;
-		total += vs[0].getInt();
-		if (total < prev_total)
+		int n = (length - k < VALUE_BATCH) ? length - k : VALUE_BATCH;
+		getInts(values, n);
+		for (int i = 0; i < n; i++)
 		{
-			unpack_abort("overflow detected");
+			int prev_total = total;
+			total += values[i];
+			if (total < prev_total)
+			{
+				unpack_abort("overflow detected");
+			}
 		}
 	}
 	rewind();
@@ -212,11 +214,17 @@ int band::getIntCount(int tag)
 		{
 			// Lazily calculate an approximate histogram.
 			hist0 = U_NEW(int, (HIST0_MAX - HIST0_MIN) + 1);
-			for (int k = length; k > 0; k--)
+			int values[VALUE_BATCH];
+			for (int k = 0; k < length; k += VALUE_BATCH)
 			{
-				int x = vs[0].getInt();
-				if (x >= HIST0_MIN && x <= HIST0_MAX)
-					hist0[x - HIST0_MIN] += 1;
+				int n = (length - k < VALUE_BATCH) ? length - k : VALUE_BATCH;
+				vs[0].getInts(values, n);
+				for (int i = 0; i < n; i++)
+				{
+					int x = values[i];
+					if (x >= HIST0_MIN && x <= HIST0_MAX)
+						hist0[x - HIST0_MIN] += 1;
+				}
 			}
 			rewind();
 		}
@@ -134,6 +134,11 @@ struct band
 		assert(ix == nullptr);
 		return vs[0].getInt();
 	}
+	void getInts(int *values, int N)
+	{
+		assert(ix == nullptr);
+		vs[0].getInts(values, N);
+	}
 	entry *getRefN()
 	{
 		assert(ix != nullptr);
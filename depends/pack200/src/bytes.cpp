@@ -215,3 +215,111 @@ int intlist::indexOf(int x)
 	}
 	return -1;
 }
+
+// fresh blocks for small allocations. bigger ones get a block of their own
+enum
+{
+	ARENA_BLOCK = (1 << 18),
+	ARENA_BIG = (1 << 15),
+	// a spare block may be this many times bigger than what it's taken for
+	ARENA_SLACK = 2
+};
+
+arena::block *arena::take(size_t size)
+{
+	// the smallest spare block that fits, unless that would waste most of it
+	block **best = nullptr;
+	for (block **b = &spare; *b != nullptr; b = &(*b)->next)
+	{
+		if ((*b)->size >= size && (best == nullptr || (*b)->size < (*best)->size))
+			best = b;
+	}
+	if (best != nullptr && (*best)->size / ARENA_SLACK <= size)
+	{
+		block *found = *best;
+		*best = found->next;
+		return found;
+	}
+	block *fresh = (block *)must_malloc(add_size(sizeof(block), size));
+	fresh->size = size;
+	mallocs++;
+	return fresh;
+}
+
+void *arena::alloc(size_t size)
+{
+	size = add_size(size, -size & 7); // round up mod 8
+	int8_t *res;
+	if (size > ARENA_BIG)
+	{
+		// behind the block being filled, which stays the first one
+		block *big = take(size);
+		if (blocks == nullptr)
+		{
+			big->next = nullptr;
+			blocks = big;
+		}
+		else
+		{
+			big->next = blocks->next;
+			blocks->next = big;
+		}
+		res = (int8_t *)(big + 1);
+	}
+	else
+	{
+		if (fill == nullptr || (size_t)(limit - fill) < size)
+		{
+			block *b = take(ARENA_BLOCK);
+			b->next = blocks;
+			blocks = b;
+			fill = (int8_t *)(b + 1);
+			limit = fill + b->size;
+		}
+		res = fill;
+		fill += size;
+	}
+	// reused memory isn't clean, and callers count on it
+	memset(res, 0, size);
+	return res;
+}
+
+void arena::rewind()
+{
+	while (blocks != nullptr)
+	{
+		block *b = blocks;
+		blocks = b->next;
+		b->next = spare;
+		spare = b;
+	}
+	fill = limit = nullptr;
+}
+
+void arena::trim(size_t keep)
+{
+	block **b = &spare;
+	while (*b != nullptr)
+	{
+		block *cur = *b;
+		if (keep < cur->size)
+		{
+			*b = cur->next;
+			::free(cur);
+			continue;
+		}
+		keep -= cur->size;
+		b = &cur->next;
+	}
+}
+
+void arena::free()
+{
+	rewind();
+	while (spare != nullptr)
+	{
+		block *b = spare;
+		spare = b->next;
+		::free(b);
+	}
+}
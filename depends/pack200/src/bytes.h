@@ -245,6 +245,35 @@ struct ptrlist : fillbytes
 	}
 	void freeAll(); // frees every ptr on the list, plus the list itself
 };
+
+// Bump-pointer allocator for memory that is released all at once.
+// Rewinding keeps the blocks for the next round, so a multi-segment archive
+// allocates most of its memory only once. All zero is a valid empty arena.
+struct arena
+{
+	struct block
+	{
+		block *next;
+		size_t size; // usable bytes after the header
+	};
+	block *blocks; // in use, the first one is being filled
+	block *spare;  // rewound, reused before anything new is allocated
+	int8_t *fill;
+	int8_t *limit;
+	size_t mallocs; // blocks ever allocated, for statistics
+
+	// zeroed memory, 8 byte aligned
+	void *alloc(size_t size);
+	// release everything allocated, but keep the memory
+	void rewind();
+	// free spare blocks, until at most keep bytes of them are left
+	void trim(size_t keep);
+	// give the memory back
+	void free();
+
+	block *take(size_t size);
+};
+
 // Use a macro rather than mess with subtle mismatches
 // between member and non-member function pointers.
 #define PTRLIST_QSORT(ptrls, fn) ::qsort((ptrls).base(), (ptrls).length(), sizeof(void *), fn)
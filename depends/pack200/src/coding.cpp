@@ -324,6 +324,102 @@ void coding::parseMultiple(byte *&rp, int N, byte *limit, int B, int H)
 	return;
 }
 
+// Batched decoding of whole runs of values.  Most values of a band fit in
+// their first byte, so that case is checked first and everything else is
+// unrolled for the (B,H) codings that carry most of the data.
+// The loops stop at limit, like getInt() would, and rely on the same
+// zero-padding past the end of the band.
+
+template <int B, int lgH>
+static int parse_run_lgH(byte *&rp, byte *limit, uint32_t *values, int N)
+{
+	const uint32_t L = 256 - (1 << lgH);
+	byte *ptr = rp;
+	int n = 0;
+	for (; n < N && ptr < limit; n++)
+	{
+		uint32_t b_i = *ptr++ & 0xFF;
+		if (B == 1 || b_i < L)
+		{
+			values[n] = b_i;
+			continue;
+		}
+		uint32_t sum = b_i;
+		for (int i = 1; i < B; i++)
+		{
+			b_i = *ptr++ & 0xFF;
+			sum += b_i << (lgH * i);
+			if (b_i < L)
+				break;
+		}
+		values[n] = sum;
+	}
+	rp = ptr;
+	return n;
+}
+
+// Fixed-size codings (H == 256) need no branches at all.
+template <int B>
+static int parse_run_fixed(byte *&rp, byte *limit, uint32_t *values, int N)
+{
+	byte *ptr = rp;
+	int n = 0;
+	if (limit - ptr < (ptrdiff_t)N * B)
+		N = (int)((limit - ptr + B - 1) / B);
+	for (; n < N; n++)
+	{
+		uint32_t sum = 0;
+		for (int i = 0; i < B; i++)
+			sum += (uint32_t)(ptr[i] & 0xFF) << (8 * i);
+		values[n] = sum;
+		ptr += B;
+	}
+	rp = ptr;
+	return n;
+}
+
+int coding::parseArray(byte *&rp, byte *limit, int B, int H, uint32_t *values, int N)
+{
+	switch (CODING_SPEC(B, H, 0, 0))
+	{
+	case BYTE1_spec:
+		return parse_run_fixed<1>(rp, limit, values, N);
+	case CODING_SPEC(2, 256, 0, 0):
+		return parse_run_fixed<2>(rp, limit, values, N);
+	case CODING_SPEC(3, 256, 0, 0):
+		return parse_run_fixed<3>(rp, limit, values, N);
+	case UNSIGNED4_spec:
+		return parse_run_fixed<4>(rp, limit, values, N);
+	case CHAR3_spec:
+		return parse_run_lgH<3, 7>(rp, limit, values, N);
+	case BCI5_spec:
+		return parse_run_lgH<5, 2>(rp, limit, values, N);
+	case CODING_SPEC(5, 16, 0, 0):
+		return parse_run_lgH<5, 4>(rp, limit, values, N);
+	case CODING_SPEC(5, 32, 0, 0):
+		return parse_run_lgH<5, 5>(rp, limit, values, N);
+	case UNSIGNED5_spec:
+		return parse_run_lgH<5, 6>(rp, limit, values, N);
+	case CODING_SPEC(5, 128, 0, 0):
+		return parse_run_lgH<5, 7>(rp, limit, values, N);
+	case CODING_SPEC(2, 4, 0, 0):
+		return parse_run_lgH<2, 2>(rp, limit, values, N);
+	case CODING_SPEC(4, 8, 0, 0):
+		return parse_run_lgH<4, 3>(rp, limit, values, N);
+	case CODING_SPEC(3, 16, 0, 0):
+		return parse_run_lgH<3, 4>(rp, limit, values, N);
+	default:
+		break;
+	}
+	// everything else, one value at a time
+	byte *ptr = rp;
+	int n = 0;
+	for (; n < N && ptr < limit; n++)
+		values[n] = parse(ptr, B, H);
+	rp = ptr;
+	return n;
+}
+
 bool value_stream::hasHelper()
 {
 	// If my coding method is a pop-style method,
@@ -617,6 +713,78 @@ int value_stream::getInt()
 	return 0;
 }
 
+void value_stream::getInts(int *values, int N)
+{
+	while (N > 0)
+	{
+		if (rp >= rplimit || cmk == cmk_ERROR || cmk >= cmk_BHS_LIMIT)
+		{
+			// next coding segment, pop codings and errors are left to getInt
+			*values++ = getInt();
+			N--;
+			continue;
+		}
+		CODING_PRIVATE(c.spec);
+		uint32_t *uvals = (uint32_t *)values;
+#ifndef NDEBUG
+		// the scalar decoder is the reference
+		value_stream check = (*this);
+#endif
+		int n = coding::parseArray(rp, rplimit, B, H, uvals, N);
+		assert(n > 0);
+		int i;
+		switch (cmk)
+		{
+		case cmk_BHS:
+			if (S != 0)
+			{
+				for (i = 0; i < n; i++)
+					values[i] = decode_sign(S, uvals[i]);
+			}
+			break;
+		case cmk_BHS1:
+			for (i = 0; i < n; i++)
+				values[i] = DECODE_SIGN_S1(uvals[i]);
+			break;
+		case cmk_BRANCH5:
+			for (i = 0; i < n; i++)
+				values[i] = decode_sign(S, uvals[i]);
+			break;
+		case cmk_BHSD1:
+			for (i = 0; i < n; i++)
+			{
+				uint32_t uval = uvals[i];
+				if (S != 0)
+					uval = (uint32_t)decode_sign(S, uval);
+				values[i] = getDeltaValue(this, uval, (bool)c.isSubrange);
+			}
+			break;
+		case cmk_BHS1D1full:
+		case cmk_DELTA5:
+			for (i = 0; i < n; i++)
+			{
+				sum += DECODE_SIGN_S1(uvals[i]);
+				values[i] = sum;
+			}
+			break;
+		case cmk_BHS1D1sub:
+			for (i = 0; i < n; i++)
+				values[i] = getDeltaValue(this, (uint32_t)DECODE_SIGN_S1(uvals[i]), true);
+			break;
+		default:
+			// unsigned, the raw values are it
+			break;
+		}
+#ifndef NDEBUG
+		for (i = 0; i < n; i++)
+			assert(check.getInt() == values[i]);
+		assert(check.rp == rp && check.sum == sum);
+#endif
+		values += n;
+		N -= n;
+	}
+}
+
 static int moreCentral(int x, int y)
 { // used to find end of Pop.{F}
 	// Suggested implementation from the Pack200 specification:
@@ -830,14 +998,20 @@ void coding_method::init(byte *&band_rp, byte *band_limit, byte *&meta_rp, int m
 		// Also verify that they are in bounds.
 		int UN = 0; // one {U} for each zero in {T}
 		value_stream vs = vs0;
-		for (int i = 0; i < N; i++)
+		int tokens[VALUE_BATCH];
+		for (int i = 0; i < N; i += VALUE_BATCH)
 		{
-			uint32_t val = vs.getInt();
-			if (val == 0)
-				UN += 1;
-			if (!(val <= (uint32_t)fVlength))
+			int n = (N - i < VALUE_BATCH) ? N - i : VALUE_BATCH;
+			vs.getInts(tokens, n);
+			for (int k = 0; k < n; k++)
 			{
-				unpack_abort("pop token out of range");
+				uint32_t val = tokens[k];
+				if (val == 0)
+					UN += 1;
+				if (!(val <= (uint32_t)fVlength))
+				{
+					unpack_abort("pop token out of range");
+				}
 			}
 		}
 		vs.done();
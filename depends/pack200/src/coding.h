@@ -87,6 +87,8 @@ struct coding
 	static uint32_t parse(byte *&rp, int B, int H);
 	static uint32_t parse_lgH(byte *&rp, int B, int H, int lgH);
 	static void parseMultiple(byte *&rp, int N, byte *limit, int B, int H);
+	// Up to N values at once, stopping at limit.  Returns how many were parsed.
+	static int parseArray(byte *&rp, byte *limit, int B, int H, uint32_t *values, int N);
 
 	uint32_t parse(byte *&rp)
 	{
@@ -164,7 +166,8 @@ enum
 enum
 {
 	B_MAX = 5,
-	C_SLOP = B_MAX * 10
+	C_SLOP = B_MAX * 10,
+	VALUE_BATCH = 256 // values pulled out of a band at once
 };
 
 struct coding_method;
@@ -195,6 +198,9 @@ struct value_stream
 	// Parse and decode a single value.
 	int getInt();
 
+	// Parse and decode N values, the same as N calls to getInt().
+	void getInts(int *values, int N);
+
 	// Parse and decode a single byte, with no error checks.
 	int getByte()
 	{
@@ -286,12 +286,9 @@ void unpacker::free()
 	/*
 	 * free everybody ever allocated with U_NEW or (recently) with T_NEW
 	 */
-	assert(smallbuf.base() == nullptr || mallocs.contains(smallbuf.base()));
-	assert(tsmallbuf.base() == nullptr || tmallocs.contains(tsmallbuf.base()));
-	mallocs.freeAll();
 	tmallocs.freeAll();
-	smallbuf.init();
-	tsmallbuf.init();
+	heap.free();
+	theap.free();
 	bcimap.free();
 	class_fixup_type.free();
 	class_fixup_offset.free();
@@ -488,27 +485,18 @@ void unpacker::putu1ref(entry *e)
 enum
 {
 	CHUNK = (1 << 14),
-	SMALL = (1 << 9)
+	SMALL = (1 << 9),
+	// spare arena memory kept from one segment for the next
+	ARENA_KEEP = (1 << 22)
 };
 
-// Call malloc.  Try to combine small blocks and free much later.
+// Carve it out of an arena.  The heap lives until the end of the segment,
+// the temporary heap until the next client request.  Big blocks get their
+// own chunk, so smallOK no longer makes a difference.
 void *unpacker::alloc_heap(size_t size, bool smallOK, bool temp)
 {
-	if (!smallOK || size > SMALL)
-	{
-		void *res = must_malloc((int)size);
-		(temp ? &tmallocs : &mallocs)->add(res);
-		return res;
-	}
-	fillbytes &xsmallbuf = *(temp ? &tsmallbuf : &smallbuf);
-	if (!xsmallbuf.canAppend(size + 1))
-	{
-		xsmallbuf.init(CHUNK);
-		(temp ? &tmallocs : &mallocs)->add(xsmallbuf.base());
-	}
-	int growBy = (int)size;
-	growBy += -growBy & 7; // round up mod 8
-	return xsmallbuf.grow(growBy);
+	(void)smallOK;
+	return (temp ? &theap : &heap)->alloc(size);
 }
 
 void unpacker::saveTo(bytes &b, byte *ptr, size_t len)
@@ -1040,6 +1028,7 @@ void unpacker::read_Utf8_values(entry *cpMap, int len)
 	int nbigsuf = 0;
 	fillbytes charbuf; // buffer to allocate small strings
 	charbuf.init();
+	int chvals[VALUE_BATCH]; // chars, as they come out of the bands
 
 	// Third band:  Read the char values in the unshared suffixes:
 	cp_Utf8_chars.readData(cp_Utf8_suffix.getIntTotal());
@@ -1075,10 +1064,12 @@ void unpacker::read_Utf8_values(entry *cpMap, int len)
 		}
 
 		byte *chp = chars.ptr;
-		for (int j = 0; j < suffix; j++)
+		for (int j = 0; j < suffix; j += VALUE_BATCH)
 		{
-			unsigned short ch = cp_Utf8_chars.getInt();
-			chp = store_Utf8_char(chp, ch);
+			int n = (suffix - j < VALUE_BATCH) ? suffix - j : VALUE_BATCH;
+			cp_Utf8_chars.getInts(chvals, n);
+			for (int k = 0; k < n; k++)
+				chp = store_Utf8_char(chp, (unsigned short)chvals[k]);
 		}
 		// shrink to fit:
 		if (isMalloc)
@@ -1144,10 +1135,12 @@ void unpacker::read_Utf8_values(entry *cpMap, int len)
 		byte *chp = chars.ptr;
 		band saved_band = cp_Utf8_big_chars;
 		cp_Utf8_big_chars.readData(suffix);
-		for (int j = 0; j < suffix; j++)
+		for (int j = 0; j < suffix; j += VALUE_BATCH)
 		{
-			unsigned short ch = cp_Utf8_big_chars.getInt();
-			chp = store_Utf8_char(chp, ch);
+			int n = (suffix - j < VALUE_BATCH) ? suffix - j : VALUE_BATCH;
+			cp_Utf8_big_chars.getInts(chvals, n);
+			for (int k = 0; k < n; k++)
+				chp = store_Utf8_char(chp, (unsigned short)chvals[k]);
 		}
 		chars.realloc(chp - chars.ptr);
 		tmallocs.add(chars.ptr); // free it later
@@ -3504,14 +3497,27 @@ void unpacker::reset()
 	infileptr = nullptr;	   // make asserts happy
 	jarout = nullptr;		  // do not close the output jar
 	gzin = nullptr;			// do not close the input gzip stream
+	// the next segment reuses the memory of this one, within reason
+	heap.rewind();
+	heap.trim(ARENA_KEEP);
+	theap.rewind();
+	theap.trim(ARENA_KEEP);
+	save_u.heap = heap;
+	save_u.theap = theap;
+	heap = arena();
+	theap = arena();
 	this->free();
 	this->init(read_input_fn);
 
 	// restore selected interface state:
 	infileptr = save_u.infileptr;
+	stream_read = save_u.stream_read;
+	stream_context = save_u.stream_context;
 	inbytes = save_u.inbytes;
 	jarout = save_u.jarout;
 	gzin = save_u.gzin;
+	heap = save_u.heap;
+	theap = save_u.theap;
 	verbose = save_u.verbose;
 	deflate_hint_or_zero = save_u.deflate_hint_or_zero;
 	modification_time_or_zero = save_u.modification_time_or_zero;
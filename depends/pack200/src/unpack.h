@@ -23,6 +23,8 @@
  * questions.
  */
 
+#include "unpack200.h"
+
 // Global Structures
 struct jar;
 struct gunzip;
@@ -159,6 +161,8 @@ struct unpacker
 
 	// if running Unix-style, here are the inputs and outputs
 	FILE *infileptr; // buffered
+	unpack_200_read_fn stream_read; // or a callback, with its context
+	void *stream_context;
 	bytes inbytes;   // direct
 	gunzip *gzin;	// gunzip filter, if any
 	jar *jarout;	 // output JAR file
@@ -166,10 +170,9 @@ struct unpacker
 	// pointer to self, for U_NEW macro
 	unpacker *u;
 
-	ptrlist mallocs;	 // list of guys to free when we are all done
 	ptrlist tmallocs;	// list of guys to free on next client request
-	fillbytes smallbuf;  // supplies small alloc requests
-	fillbytes tsmallbuf; // supplies temporary small alloc requests
+	arena heap;			 // supplies alloc requests, until the next segment
+	arena theap;		 // supplies temporary alloc requests
 
 	// option management members
 	int verbose;			  // verbose level, 0 means no output
@@ -378,7 +381,7 @@ struct unpacker
 	// Deallocates temporary storage (volatile after next client call).
 	void free_temps()
 	{
-		tsmallbuf.init();
+		theap.rewind();
 		tmallocs.freeAll();
 	}
 
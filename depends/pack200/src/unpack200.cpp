@@ -71,6 +71,26 @@ static int64_t read_input_via_stdio(unpacker *u, void *buf, int64_t minlen, int6
 	return numread;
 }
 
+// Callback for fetching data, from whoever called unpack_200_stream.
+static int64_t read_input_via_callback(unpacker *u, void *buf, int64_t minlen, int64_t maxlen)
+{
+	assert(u->stream_read != nullptr);
+	assert(minlen <= maxlen); // don't talk nonsense
+	int64_t numread = 0;
+	char *bufptr = (char *)buf;
+	while (numread < minlen)
+	{
+		int64_t nr = u->stream_read(u->stream_context, bufptr, maxlen - numread);
+		if (nr <= 0)
+			break;
+		numread += nr;
+		bufptr += nr;
+		assert(numread <= maxlen);
+	}
+	return numread;
+}
+
+
 enum
 {
 	EOF_MAGIC = 0,
@@ -94,20 +114,9 @@ static int read_magic(unpacker *u, char peek[], int peeklen)
 	return magic;
 }
 
-void unpack_200(FILE *input, FILE *output)
+// Unpacks everything, once the input and output are set up
+static void unpack_all(unpacker &u)
 {
-	unpacker u;
-	u.init(read_input_via_stdio);
-
-	// initialize jar output
-	// the output takes ownership of the file handle
-	jar jarout;
-	jarout.init(&u);
-	jarout.jarfp = output;
-
-	// the input doesn't
-	u.infileptr = input;
-
 	// read the magic!
 	char peek[4];
 	int magic;
@@ -158,5 +167,37 @@ void unpack_200(FILE *input, FILE *output)
 	}
 	u.finish();
 	u.free(); // tidy up malloc blocks
+}
+
+void unpack_200(FILE *input, FILE *output)
+{
+	unpacker u;
+	u.init(read_input_via_stdio);
+
+	// initialize jar output
+	// the output takes ownership of the file handle
+	jar jarout;
+	jarout.init(&u);
+	jarout.jarfp = output;
+
+	// the input doesn't
+	u.infileptr = input;
+
+	unpack_all(u);
 	fclose(input);
 }
+
+void unpack_200_stream(unpack_200_read_fn read, unpack_200_write_fn write, void *context)
+{
+	unpacker u;
+	u.init(read_input_via_callback);
+	u.stream_read = read;
+	u.stream_context = context;
+
+	jar jarout;
+	jarout.init(&u);
+	jarout.write_fn = write;
+	jarout.write_context = context;
+
+	unpack_all(u);
+}
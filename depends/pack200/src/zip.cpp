@@ -49,10 +49,11 @@
 #include "zip.h"
 
 #include "zlib.h"
+#include "checksum.h"
 
 inline uint32_t jar::get_crc32(uint32_t c, uchar *ptr, uint32_t len)
 {
-	return crc32(c, ptr, len);
+	return checksum_crc32(c, ptr, len);
 }
 
 // FIXME: this is bullshit. Do real endianness detection.
@@ -76,6 +77,13 @@ void jar::init(unpacker *u_)
 // Write data to the ZIP output stream.
 void jar::write_data(void *buff, int len)
 {
+	if (write_fn)
+	{
+		if (!write_fn(write_context, buff, len))
+			unpack_abort("write on output failed");
+		output_file_offset += len;
+		return;
+	}
 	while (len > 0)
 	{
 		int rc = (int)fwrite(buff, 1, len, jarfp);
@@ -311,6 +319,10 @@ void jar::closeJarFile(bool central)
 		fflush(jarfp);
 		fclose(jarfp);
 	}
+	else if (write_fn && central)
+	{
+		write_central_directory();
+	}
 	reset();
 }
 
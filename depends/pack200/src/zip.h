@@ -23,6 +23,7 @@
  * questions.
  */
 #include <stdint.h>
+#include "unpack200.h"
 typedef unsigned short ushort;
 typedef unsigned int uint32_t;
 typedef unsigned char uchar;
@@ -33,6 +34,9 @@ struct jar
 {
 	// JAR file writer
 	FILE *jarfp;
+	// or a callback, with its context
+	unpack_200_write_fn write_fn;
+	void *write_context;
 	int default_modtime;
 
 	// Used by unix2dostime:
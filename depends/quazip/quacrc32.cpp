@@ -1,6 +1,6 @@
 #include "quacrc32.h"
 
-#include "zlib.h"
+#include "checksum.h"
 
 QuaCrc32::QuaCrc32()
 {
@@ -9,17 +9,17 @@ QuaCrc32::QuaCrc32()
 
 quint32 QuaCrc32::calculate(const QByteArray &data)
 {
-	return crc32( crc32(0L, Z_NULL, 0), (const Bytef*)data.data(), data.size() );
+	return checksum_crc32( 0, data.data(), data.size() );
 }
 
 void QuaCrc32::reset()
 {
-	checksum = crc32(0L, Z_NULL, 0);
+	checksum = 0;
 }
 
 void QuaCrc32::update(const QByteArray &buf)
 {
-	checksum = crc32( checksum, (const Bytef*)buf.data(), buf.size() );
+	checksum = checksum_crc32( checksum, buf.data(), buf.size() );
 }
 
 quint32 QuaCrc32::value()
@@ -17,6 +17,7 @@
 #include <string.h>
 #include <time.h>
 #include "zlib.h"
+#include "checksum.h"
 #include "zip.h"
 #include "quazip_global.h"
 
@@ -1005,7 +1006,7 @@ extern int ZEXPORT zipWriteInFileInZip (file, buf, len)
 
     zi->ci.stream.next_in = (void*)buf;
     zi->ci.stream.avail_in = len;
-    zi->ci.crc32 = crc32(zi->ci.crc32,buf,len);
+    zi->ci.crc32 = checksum_crc32(zi->ci.crc32,buf,len);
 
     while ((err==ZIP_OK) && (zi->ci.stream.avail_in>0))
     {
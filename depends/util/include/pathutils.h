@@ -53,6 +53,19 @@ LIBUTIL_EXPORT bool ensureFolderPathExists(QString filenamepath);
 
 LIBUTIL_EXPORT bool copyPath(QString src, QString dst);
 
+/**
+ * Puts a file at dst with the contents of src, sharing the data with src if possible.
+ * Tries a reflink (copy on write clone), a hard link and a symbolic link, in that order, and
+ * only copies the file if none of them work. dst must not exist yet.
+ */
+LIBUTIL_EXPORT bool linkOrCopyFile(QString src, QString dst);
+
+/**
+ * Moves src over dst in one step. dst is either the old file or the new one at any point,
+ * even if this fails or the process dies while doing it. Both must be on the same filesystem.
+ */
+LIBUTIL_EXPORT bool replaceFile(QString src, QString dst);
+
 /// Opens the given file in the default application.
 LIBUTIL_EXPORT void openFileInDefaultProgram(QString filename);
 
@@ -14,12 +14,25 @@
  */
 
 #include "include/pathutils.h"
+#include "include/osutils.h"
 
 #include <QFileInfo>
 #include <QDir>
 #include <QDesktopServices>
 #include <QUrl>
 
+#if WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <cstdio>
+#endif
+#if LINUX
+#include <linux/fs.h>
+#endif
+
 QString PathCombine(QString path1, QString path2)
 {
     return QDir::cleanPath(path1 + QDir::separator() + path2);
@@ -129,6 +142,77 @@ bool copyPath(QString src, QString dst)
 	return true;
 }
 
+namespace
+{
+bool reflinkFile(const QString &src, const QString &dst)
+{
+#if LINUX && defined(FICLONE)
+	int in = ::open(QFile::encodeName(src).constData(), O_RDONLY);
+	if (in < 0)
+		return false;
+	int out = ::open(QFile::encodeName(dst).constData(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+	if (out < 0)
+	{
+		::close(in);
+		return false;
+	}
+	// only works within one filesystem that can share extents, like btrfs or xfs
+	bool cloned = ::ioctl(out, FICLONE, in) == 0;
+	::close(out);
+	::close(in);
+	if (!cloned)
+		QFile::remove(dst);
+	return cloned;
+#else
+	Q_UNUSED(src);
+	Q_UNUSED(dst);
+	return false;
+#endif
+}
+
+bool hardlinkFile(const QString &src, const QString &dst)
+{
+#if WINDOWS
+	QString nativeSrc = QDir::toNativeSeparators(QFileInfo(src).absoluteFilePath());
+	QString nativeDst = QDir::toNativeSeparators(QFileInfo(dst).absoluteFilePath());
+	return CreateHardLinkW((LPCWSTR)nativeDst.utf16(), (LPCWSTR)nativeSrc.utf16(), NULL);
+#else
+	return ::link(QFile::encodeName(src).constData(), QFile::encodeName(dst).constData()) == 0;
+#endif
+}
+
+bool symlinkFile(const QString &src, const QString &dst)
+{
+#if WINDOWS
+	// QFile::link makes a shortcut here, which is of no use to anything but explorer
+	Q_UNUSED(src);
+	Q_UNUSED(dst);
+	return false;
+#else
+	return QFile::link(QFileInfo(src).absoluteFilePath(), dst);
+#endif
+}
+}
+
+bool linkOrCopyFile(QString src, QString dst)
+{
+	return reflinkFile(src, dst) || hardlinkFile(src, dst) || symlinkFile(src, dst) ||
+		   QFile::copy(src, dst);
+}
+
+bool replaceFile(QString src, QString dst)
+{
+#if WINDOWS
+	QString nativeSrc = QDir::toNativeSeparators(QFileInfo(src).absoluteFilePath());
+	QString nativeDst = QDir::toNativeSeparators(QFileInfo(dst).absoluteFilePath());
+	return MoveFileExW((LPCWSTR)nativeSrc.utf16(), (LPCWSTR)nativeDst.utf16(),
+					   MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+	// QFile::rename refuses to overwrite, plain rename does it atomically
+	return ::rename(QFile::encodeName(src).constData(), QFile::encodeName(dst).constData()) == 0;
+#endif
+}
+
 void openDirInDefaultProgram(QString path, bool ensureExists)
 {
 	QDir parentPath;
@@ -66,6 +66,7 @@
 #include "gui/pages/global/ExternalToolsPage.h"
 #include "gui/pages/global/AccountListPage.h"
 #include "gui/pages/global/ProxyPage.h"
+#include "gui/pages/global/NetworkPage.h"
 #include "gui/pages/global/JavaPage.h"
 #include "gui/pages/global/MinecraftPage.h"
 
@@ -258,6 +259,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
 		m_globalSettingsProvider->addPage<MinecraftPage>();
 		m_globalSettingsProvider->addPage<JavaPage>();
 		m_globalSettingsProvider->addPage<ProxyPage>();
+		m_globalSettingsProvider->addPage<NetworkPage>();
 		m_globalSettingsProvider->addPage<ExternalToolsPage>();
 		m_globalSettingsProvider->addPage<AccountListPage>();
 	}
@@ -294,6 +296,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
 	if (!skin_dls.isEmpty())
 	{
 		auto job = new NetJob("Startup player skins download");
+		job->setPriority(Priority_Background);
 		connect(job, SIGNAL(succeeded()), SLOT(skinJobFinished()));
 		connect(job, SIGNAL(failed()), SLOT(skinJobFinished()));
 		for (auto action : skin_dls)
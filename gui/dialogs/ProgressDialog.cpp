@@ -28,6 +28,10 @@ ProgressDialog::ProgressDialog(QWidget *parent) : QDialog(parent), ui(new Ui::Pr
 	this->setWindowFlags(this->windowFlags() & ~Qt::WindowContextHelpButtonHint);
 	setSkipButton(false);
 	changeProgress(0, 100);
+	ui->rateLabel->setVisible(false);
+	connect(&m_progress, SIGNAL(progress(qint64, qint64)), SLOT(changeProgress(qint64, qint64)));
+	connect(&m_progress, SIGNAL(throughputChanged(double, qint64)),
+			SLOT(changeThroughput(double, qint64)));
 }
 
 void ProgressDialog::setSkipButton(bool present, QString label)
@@ -63,7 +67,7 @@ int ProgressDialog::exec(ProgressProvider *task)
 	connect(task, SIGNAL(failed(QString)), SLOT(onTaskFailed(QString)));
 	connect(task, SIGNAL(succeeded()), SLOT(onTaskSucceeded()));
 	connect(task, SIGNAL(status(QString)), SLOT(changeStatus(const QString &)));
-	connect(task, SIGNAL(progress(qint64, qint64)), SLOT(changeProgress(qint64, qint64)));
+	m_progress.watch(task);
 
 	// if this didn't connect to an already running task, invoke start
 	if(!task->isRunning())
@@ -105,6 +109,32 @@ void ProgressDialog::changeProgress(qint64 current, qint64 total)
 	ui->taskProgressBar->setValue(current);
 }
 
+void ProgressDialog::changeThroughput(double throughput, qint64 secondsLeft)
+{
+	QStringList parts;
+	// Task::setProgress reports percent, the downloads report bytes
+	if (m_progress.total() > 100 && throughput > 0)
+	{
+		if (throughput >= 1024 * 1024)
+			parts << tr("%1 MiB/s").arg(throughput / (1024.0 * 1024.0), 0, 'f', 1);
+		else
+			parts << tr("%1 KiB/s").arg(throughput / 1024.0, 0, 'f', 1);
+	}
+	if (secondsLeft >= 60)
+		parts << tr("about %1:%2 left").arg(secondsLeft / 60).arg(secondsLeft % 60, 2, 10,
+																	QChar('0'));
+	else if (secondsLeft >= 0)
+		parts << tr("about %1 s left").arg(secondsLeft);
+
+	QString text = parts.join(", ");
+	ui->rateLabel->setText(text);
+	if (ui->rateLabel->isHidden() != text.isEmpty())
+	{
+		ui->rateLabel->setVisible(!text.isEmpty());
+		updateSize();
+	}
+}
+
 void ProgressDialog::keyPressEvent(QKeyEvent *e)
 {
 	if (e->key() == Qt::Key_Escape)
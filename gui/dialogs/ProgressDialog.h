@@ -16,6 +16,7 @@
 #pragma once
 
 #include <QDialog>
+#include "logic/tasks/ProgressAggregator.h"
 
 class ProgressProvider;
 
@@ -48,6 +49,7 @@ slots:
 
 	void changeStatus(const QString &status);
 	void changeProgress(qint64 current, qint64 total);
+	void changeThroughput(double throughput, qint64 secondsLeft);
 
 	
 private
@@ -62,4 +64,7 @@ private:
 	Ui::ProgressDialog *ui;
 
 	ProgressProvider *task;
+
+	/// keeps the progress bar from repainting on every chunk of every download
+	ProgressAggregator m_progress;
 };
@@ -0,0 +1,106 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NetworkPage.h"
+#include "ui_NetworkPage.h"
+
+#include "logic/settings/SettingsObject.h"
+#include "logic/net/HostScheduler.h"
+#include "MultiMC.h"
+
+#include <QDateTime>
+
+NetworkPage::NetworkPage(QWidget *parent) : QWidget(parent), ui(new Ui::NetworkPage)
+{
+	ui->setupUi(this);
+	ui->tabWidget->tabBar()->hide();
+	loadSettings();
+	refreshHosts();
+
+	connect(ui->adaptiveCheckBox, SIGNAL(toggled(bool)), SLOT(adaptiveChanged(bool)));
+	connect(MMC->hostScheduler().get(), SIGNAL(stateChanged()), SLOT(refreshHosts()));
+}
+
+NetworkPage::~NetworkPage()
+{
+	delete ui;
+}
+
+bool NetworkPage::apply()
+{
+	applySettings();
+	return true;
+}
+
+void NetworkPage::adaptiveChanged(bool checked)
+{
+	ui->minSpinBox->setEnabled(checked);
+	ui->maxSpinBox->setEnabled(checked);
+}
+
+void NetworkPage::refreshHosts()
+{
+	ui->hostsView->clear();
+	for (auto state : MMC->hostScheduler()->hosts())
+	{
+		QStringList columns;
+		columns << (state.host.isEmpty() ? tr("(local)") : state.host);
+		columns << QString::number(state.effectiveLimit());
+		columns << QString::number(state.in_flight);
+		columns << tr("%1 KiB/s").arg(state.throughput / 1024.0, 0, 'f', 1);
+		columns << tr("%1 KiB").arg(state.total_bytes / 1024);
+		columns << QString::number(state.errors);
+		qint64 now = QDateTime::currentMSecsSinceEpoch();
+		if (state.paused_until > now)
+			columns << tr("Paused for %1 s").arg((state.paused_until - now + 999) / 1000);
+		else if (state.paused_until)
+			columns << tr("Testing");
+		else
+			columns << tr("OK");
+		ui->hostsView->addTopLevelItem(new QTreeWidgetItem(columns));
+	}
+}
+
+void NetworkPage::applySettings()
+{
+	auto s = MMC->settings();
+
+	// Concurrency
+	s->set("NetHostAdaptiveConcurrency", ui->adaptiveCheckBox->isChecked());
+	s->set("NetHostInitialConcurrency", ui->initialSpinBox->value());
+	s->set("NetHostMinConcurrency", ui->minSpinBox->value());
+	s->set("NetHostMaxConcurrency", qMax(ui->minSpinBox->value(), ui->maxSpinBox->value()));
+
+	// Bandwidth
+	s->set("NetRateLimit", ui->rateSpinBox->value());
+	s->set("NetTimingDump", ui->timingDumpCheckBox->isChecked());
+}
+
+void NetworkPage::loadSettings()
+{
+	auto s = MMC->settings();
+
+	// Concurrency
+	bool adaptive = s->get("NetHostAdaptiveConcurrency").toBool();
+	ui->adaptiveCheckBox->setChecked(adaptive);
+	ui->initialSpinBox->setValue(s->get("NetHostInitialConcurrency").toInt());
+	ui->minSpinBox->setValue(s->get("NetHostMinConcurrency").toInt());
+	ui->maxSpinBox->setValue(s->get("NetHostMaxConcurrency").toInt());
+	adaptiveChanged(adaptive);
+
+	// Bandwidth
+	ui->rateSpinBox->setValue(s->get("NetRateLimit").toInt());
+	ui->timingDumpCheckBox->setChecked(s->get("NetTimingDump").toBool());
+}
@@ -0,0 +1,65 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <QDialog>
+
+#include "gui/pages/BasePage.h"
+
+namespace Ui
+{
+class NetworkPage;
+}
+
+class NetworkPage : public QWidget, public BasePage
+{
+	Q_OBJECT
+
+public:
+	explicit NetworkPage(QWidget *parent = 0);
+	~NetworkPage();
+
+	QString displayName() const override
+	{
+		return tr("Network");
+	}
+	QIcon icon() const override
+	{
+		return QIcon::fromTheme("proxy");
+	}
+	QString id() const override
+	{
+		return "network-settings";
+	}
+	QString helpPage() const override
+	{
+		return "Network-settings";
+	}
+	bool apply() override;
+
+private:
+	void applySettings();
+	void loadSettings();
+
+private
+slots:
+	void adaptiveChanged(bool checked);
+	void refreshHosts();
+
+private:
+	Ui::NetworkPage *ui;
+};
@@ -0,0 +1,323 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "CacheCollector.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QtConcurrentRun>
+#include <pathutils.h>
+#include <algorithm>
+
+#include "logic/InstanceList.h"
+#include "logic/OneSixInstance.h"
+#include "logic/minecraft/InstanceVersion.h"
+#include "logic/minecraft/OneSixLibrary.h"
+#include "logic/net/HttpMetaCache.h"
+#include "logic/settings/SettingsObject.h"
+#include "logic/assets/AssetsUtils.h"
+#include "MMCError.h"
+#include "logger/QsLog.h"
+
+// the bases that are collected, and the settings with their limits in MiB
+static const struct
+{
+	const char *base;
+	const char *setting;
+} collectedBases[] = {{"libraries", "CacheLimitLibraries"},
+					  {"versions", "CacheLimitVersions"},
+					  {"asset_objects", "CacheLimitAssets"}};
+
+namespace
+{
+struct Candidate
+{
+	QString path;
+	qint64 size;
+	qint64 last_access;
+	/// null for the asset objects, those aren't in the metacache
+	MetaEntryPtr entry;
+};
+
+void collectBase(CacheBaseReport &report, bool dryRun)
+{
+	auto metacache = MMC->metacache();
+	QString root = metacache->getBasePath(report.base);
+	QDir rootDir(root);
+	bool isObjectStore = report.base == "asset_objects";
+	QList<Candidate> candidates;
+
+	// everything in the base counts against the limit
+	QDirIterator iter(root, QDir::Files, QDirIterator::Subdirectories);
+	while (iter.hasNext())
+	{
+		iter.next();
+		QFileInfo info = iter.fileInfo();
+		QString path = rootDir.relativeFilePath(info.filePath());
+		report.files++;
+		report.total_size += info.size();
+		if (report.referenced.contains(path))
+		{
+			report.referenced_size += info.size();
+			continue;
+		}
+		// objects are only ever read by the game, the access time is all we have. downloads in
+		// progress (.part) and anything else in the store aren't objects and are left alone
+		if (isObjectStore && AssetsUtils::isObjectPath(path))
+		{
+			qint64 used = qMax(info.lastRead(), info.lastModified()).toMSecsSinceEpoch();
+			candidates.append({path, info.size(), used, MetaEntryPtr()});
+		}
+	}
+	// elsewhere, only files we downloaded are ours to remove
+	if (!isObjectStore)
+	{
+		for (auto entry : metacache->entries(report.base))
+		{
+			if (report.referenced.contains(entry->path))
+				continue;
+			QFileInfo info(PathCombine(root, entry->path));
+			if (!info.isFile())
+				continue;
+			candidates.append({entry->path, info.size(), entry->last_access, entry});
+		}
+	}
+
+	if (!report.budget || report.total_size <= report.budget)
+		return;
+
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b)
+	{
+		return a.last_access < b.last_access;
+	});
+	qint64 size = report.total_size;
+	for (auto candidate : candidates)
+	{
+		if (size <= report.budget)
+			break;
+		if (!dryRun)
+		{
+			bool removed = candidate.entry ? metacache->evictEntry(candidate.entry)
+										   : QFile::remove(PathCombine(root, candidate.path));
+			if (!removed)
+			{
+				report.failed++;
+				continue;
+			}
+		}
+		report.evicted.append(candidate.path);
+		report.evicted_size += candidate.size;
+		size -= candidate.size;
+	}
+	QLOG_INFO() << "Cache collector:" << (dryRun ? "would remove" : "removed")
+				<< report.evicted.size() << "files from" << report.base;
+}
+
+QList<CacheBaseReport> collectBases(QList<CacheBaseReport> reports, bool dryRun)
+{
+	for (auto &report : reports)
+	{
+		if (report.skipped.isEmpty())
+			collectBase(report, dryRun);
+	}
+	return reports;
+}
+
+QString mib(qint64 bytes)
+{
+	return QString::number(bytes / (1024.0 * 1024.0), 'f', 1);
+}
+}
+
+CacheCollector::CacheCollector(bool dryRun, QObject *parent) : Task(parent), m_dryRun(dryRun)
+{
+	connect(&m_watcher, SIGNAL(finished()), SLOT(collectFinished()));
+}
+
+void CacheCollector::executeTask()
+{
+	auto s = MMC->settings();
+	for (auto collected : collectedBases)
+	{
+		CacheBaseReport report;
+		report.base = collected.base;
+		report.budget = s->get(collected.setting).toLongLong() * 1024 * 1024;
+		m_reports.append(report);
+	}
+
+	setStatus(tr("Finding the files used by the instances..."));
+	QString reason;
+	if (!findReferences(reason))
+	{
+		emitFailed(tr("Nothing was removed, %1").arg(reason));
+		return;
+	}
+
+	if (m_dryRun)
+		setStatus(tr("Looking for unused files..."));
+	else
+		setStatus(tr("Removing unused files..."));
+	m_watcher.setFuture(QtConcurrent::run(collectBases, m_reports, m_dryRun));
+}
+
+bool CacheCollector::findReferences(QString &reason)
+{
+	auto findReport = [this](QString base) -> CacheBaseReport &
+	{
+		for (auto &report : m_reports)
+		{
+			if (report.base == base)
+				return report;
+		}
+		Q_ASSERT(false);
+		return m_reports.first();
+	};
+	auto &libraries = findReport("libraries");
+	auto &versions = findReport("versions");
+	auto &objects = findReport("asset_objects");
+	QSet<QString> assetIndexes;
+
+	auto list = MMC->instances();
+	for (int i = 0; i < list->count(); i++)
+	{
+		auto inst = list->at(i);
+		auto onesix = std::dynamic_pointer_cast<OneSixInstance>(inst);
+		// legacy instances only use their minecraft.jar
+		if (!onesix)
+		{
+			QString id = inst->intendedVersionId();
+			versions.referenced.insert(id + "/" + id + ".jar");
+			continue;
+		}
+		try
+		{
+			onesix->reloadVersion();
+		}
+		catch (MMCError &e)
+		{
+			reason = tr("the version of %1 can't be loaded: %2").arg(inst->name(), e.cause());
+			return false;
+		}
+		catch (...)
+		{
+			reason = tr("the version of %1 can't be loaded").arg(inst->name());
+			return false;
+		}
+		auto version = onesix->getFullVersion();
+		versions.referenced.insert(version->id + "/" + version->id + ".jar");
+
+		// libraries and natives, for all architectures
+		auto libs = version->getActiveNativeLibs();
+		libs.append(version->getActiveNormalLibs());
+		for (auto lib : libs)
+		{
+			if (lib->hint() == "local")
+				continue;
+			QString storage = lib->storagePath();
+			if (storage.contains("${arch}"))
+			{
+				libraries.referenced.insert(QString(storage).replace("${arch}", "32"));
+				libraries.referenced.insert(QString(storage).replace("${arch}", "64"));
+			}
+			else
+			{
+				libraries.referenced.insert(storage);
+			}
+		}
+
+		if (!version->assets.isEmpty())
+			assetIndexes.insert(version->assets);
+	}
+
+	for (auto assetName : assetIndexes)
+	{
+		AssetsIndex index;
+		if (!AssetsUtils::loadAssetsIndexJson("assets/indexes/" + assetName + ".json", &index))
+		{
+			// the objects it lists can't be told apart from unused ones
+			objects.skipped = tr("the asset index %1 can't be read").arg(assetName);
+			break;
+		}
+		for (auto object : index.objects)
+		{
+			QString hash = object.hash();
+			objects.referenced.insert(hash.left(2) + "/" + hash);
+		}
+	}
+	return true;
+}
+
+void CacheCollector::collectFinished()
+{
+	m_reports = m_watcher.result();
+	QLOG_INFO() << summary();
+	for (auto &report : m_reports)
+	{
+		if (report.failed)
+		{
+			emitFailed(summary());
+			return;
+		}
+	}
+	emitSucceeded();
+}
+
+QString CacheCollector::summary() const
+{
+	QStringList lines;
+	if (m_dryRun)
+		lines << tr("Dry run, nothing was removed.");
+	for (auto &report : m_reports)
+	{
+		lines << tr("%1: %2 files, %3 MiB, %4 MiB used by instances")
+					 .arg(report.base)
+					 .arg(report.files)
+					 .arg(mib(report.total_size))
+					 .arg(mib(report.referenced_size));
+		if (!report.skipped.isEmpty())
+		{
+			lines << "  " + tr("Skipped, %1").arg(report.skipped);
+			continue;
+		}
+		if (!report.budget)
+		{
+			lines << "  " + tr("No size limit set");
+			continue;
+		}
+		if (m_dryRun)
+			lines << "  " + tr("Limit %1 MiB, would remove %2 files (%3 MiB):")
+								.arg(mib(report.budget))
+								.arg(report.evicted.size())
+								.arg(mib(report.evicted_size));
+		else
+			lines << "  " + tr("Limit %1 MiB, removed %2 files (%3 MiB)")
+								.arg(mib(report.budget))
+								.arg(report.evicted.size())
+								.arg(mib(report.evicted_size));
+		if (m_dryRun)
+		{
+			for (auto path : report.evicted)
+				lines << "    " + path;
+		}
+		if (report.failed)
+			lines << "  " + tr("Failed to remove %1 files").arg(report.failed);
+		if (report.total_size - report.evicted_size > report.budget)
+			lines << "  " + tr("Still over the limit, the rest is used by instances or wasn't downloaded by MultiMC");
+	}
+	return lines.join("\n");
+}
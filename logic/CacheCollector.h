@@ -0,0 +1,77 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QStringList>
+#include <QSet>
+#include <QFutureWatcher>
+
+#include "logic/tasks/Task.h"
+
+/// what the collector found (and did) in one cache base
+struct CacheBaseReport
+{
+	QString base;
+	/// size limit in bytes, 0 if there is none
+	qint64 budget = 0;
+	/// files the instances need, relative to the base
+	QSet<QString> referenced;
+	/// the base can't be collected, and why
+	QString skipped;
+
+	qint64 total_size = 0;
+	qint64 referenced_size = 0;
+	int files = 0;
+	/// files that were removed, or would be in a dry run
+	QStringList evicted;
+	qint64 evicted_size = 0;
+	int failed = 0;
+};
+
+/**
+ * Keeps the shared caches (libraries, versions, asset objects) within their size limits.
+ *
+ * Files no instance uses are removed, least recently used first, until the base fits its
+ * limit again. What the instances use comes from their resolved versions. If the version of
+ * any instance can't be loaded, nothing is removed.
+ *
+ * In a dry run, nothing is removed and the report lists what would be.
+ */
+class CacheCollector : public Task
+{
+	Q_OBJECT
+public:
+	explicit CacheCollector(bool dryRun, QObject *parent = 0);
+	virtual ~CacheCollector() {};
+
+	/// human readable report, for the console
+	QString summary() const;
+
+protected:
+	virtual void executeTask();
+
+private
+slots:
+	void collectFinished();
+
+private:
+	bool findReferences(QString &reason);
+
+private:
+	bool m_dryRun;
+	QList<CacheBaseReport> m_reports;
+	QFutureWatcher<QList<CacheBaseReport>> m_watcher;
+};
@@ -0,0 +1,322 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "CacheWarmer.h"
+
+#include <QFileInfo>
+
+#include "logic/InstanceList.h"
+#include "logic/OneSixInstance.h"
+#include "logic/minecraft/MinecraftVersionList.h"
+#include "logic/minecraft/MinecraftVersion.h"
+#include "logic/minecraft/InstanceVersion.h"
+#include "logic/minecraft/OneSixLibrary.h"
+#include "logic/forge/ForgeMirrors.h"
+#include "logic/forge/ForgeXzDownload.h"
+#include "logic/net/Sha1Download.h"
+#include "logic/net/URLConstants.h"
+#include "logic/assets/AssetsUtils.h"
+#include "MMCError.h"
+#include "logger/QsLog.h"
+
+CacheWarmer::CacheWarmer(QObject *parent) : Task(parent)
+{
+}
+
+void CacheWarmer::executeTask()
+{
+	auto list = MMC->instances();
+	for (int i = 0; i < list->count(); i++)
+	{
+		auto inst = std::dynamic_pointer_cast<OneSixInstance>(list->at(i));
+		if (inst)
+			m_instances.append(inst);
+		else
+			m_legacyInstances++;
+	}
+	QLOG_INFO() << "Warming the caches for" << m_instances.size() << "instances.";
+
+	// get the newest version list, so the version files can be updated
+	setStatus(tr("Loading the Minecraft version list..."));
+	m_versionListTask.reset(MMC->minecraftlist()->getLoadTask());
+	connect(m_versionListTask.get(), SIGNAL(succeeded()), SLOT(versionListLoaded()));
+	connect(m_versionListTask.get(), SIGNAL(failed(QString)), SLOT(versionListLoaded()));
+	m_versionListTask->start();
+}
+
+void CacheWarmer::versionListLoaded()
+{
+	if (!m_versionListTask->successful())
+	{
+		QLOG_WARN() << "Couldn't load the Minecraft version list:"
+					<< m_versionListTask->failReason() << "- using the cached one.";
+	}
+	m_currentInstance = 0;
+	updateNextVersion();
+}
+
+void CacheWarmer::updateNextVersion()
+{
+	// the same as OneSixUpdate does before it downloads the libraries
+	while (m_currentInstance < m_instances.size())
+	{
+		auto inst = m_instances[m_currentInstance++];
+		if (inst->providesVersionFile())
+			continue;
+		auto version = std::dynamic_pointer_cast<MinecraftVersion>(
+			MMC->minecraftlist()->findVersion(inst->intendedVersionId()));
+		if (!version)
+		{
+			skipInstance(inst.get(), tr("unknown Minecraft version %1")
+										 .arg(inst->intendedVersionId()));
+			continue;
+		}
+		if (!version->needsUpdate())
+			continue;
+		m_versionUpdateTask = MMC->minecraftlist()->createUpdateTask(inst->intendedVersionId());
+		if (!m_versionUpdateTask)
+			continue;
+		setStatus(tr("Getting the version files for %1...").arg(inst->name()));
+		connect(m_versionUpdateTask.get(), SIGNAL(succeeded()), SLOT(updateNextVersion()));
+		connect(m_versionUpdateTask.get(), SIGNAL(failed(QString)),
+				SLOT(versionUpdateFailed(QString)));
+		m_versionUpdateTask->start();
+		return;
+	}
+	librariesStart();
+}
+
+void CacheWarmer::versionUpdateFailed(QString reason)
+{
+	skipInstance(m_instances[m_currentInstance - 1].get(), reason);
+	updateNextVersion();
+}
+
+void CacheWarmer::skipInstance(OneSixInstance *inst, QString reason)
+{
+	QLOG_WARN() << "Skipping instance" << inst->name() << ":" << reason;
+	m_skipped.append(QString("%1 (%2)").arg(inst->name(), reason));
+	for (int i = 0; i < m_instances.size(); i++)
+	{
+		if (m_instances[i].get() == inst)
+		{
+			m_instances.removeAt(i);
+			if (i < m_currentInstance)
+				m_currentInstance--;
+			break;
+		}
+	}
+}
+
+void CacheWarmer::librariesStart()
+{
+	setStatus(tr("Getting the libraries..."));
+	auto job = new NetJob(tr("Cache warm-up: libraries"));
+	m_job.reset(job);
+
+	auto metacache = MMC->metacache();
+	// base + path of everything queued, so each file is only downloaded once
+	QSet<QString> queued;
+	auto queue = [&](QString base, QString path, QUrl url)
+	{
+		if (queued.contains(base + "/" + path))
+			return;
+		queued.insert(base + "/" + path);
+		auto entry = metacache->resolveEntry(base, path);
+		if (!entry->stale)
+			return;
+		job->addNetAction(CacheDownload::make(url, entry));
+		m_queuedFiles++;
+	};
+	QList<ForgeXzDownloadPtr> forgeLibs;
+
+	for (auto inst : m_instances.mid(0))
+	{
+		try
+		{
+			inst->reloadVersion();
+		}
+		catch (MMCError &e)
+		{
+			skipInstance(inst.get(), e.cause());
+			continue;
+		}
+		catch (...)
+		{
+			skipInstance(inst.get(), tr("the version file couldn't be loaded"));
+			continue;
+		}
+		auto version = inst->getFullVersion();
+
+		// minecraft.jar
+		QString jarPath = version->id + "/" + version->id + ".jar";
+		queue("versions", jarPath, QUrl("http://" + URLConstants::AWS_DOWNLOAD_VERSIONS + jarPath));
+
+		// libraries and natives, for all architectures
+		auto libs = version->getActiveNativeLibs();
+		libs.append(version->getActiveNormalLibs());
+		for (auto lib : libs)
+		{
+			if (lib->hint() == "local")
+				continue;
+			QStringList archs;
+			if (lib->storagePath().contains("${arch}"))
+				archs << "32" << "64";
+			else
+				archs << QString();
+			for (auto arch : archs)
+			{
+				QString storage = lib->storagePath();
+				QString dl = lib->downloadUrl();
+				if (!arch.isEmpty())
+				{
+					storage.replace("${arch}", arch);
+					dl.replace("${arch}", arch);
+				}
+				if (lib->hint() != "forge-pack-xz")
+				{
+					queue("libraries", storage, QUrl(dl));
+					continue;
+				}
+				if (queued.contains("libraries/" + storage))
+					continue;
+				queued.insert("libraries/" + storage);
+				auto entry = metacache->resolveEntry("libraries", storage);
+				if (entry->stale)
+				{
+					forgeLibs.append(ForgeXzDownload::make(storage, entry));
+					m_queuedFiles++;
+				}
+			}
+		}
+
+		// the asset index. its objects are fetched once all the indexes are here
+		if (!version->assets.isEmpty())
+		{
+			m_assetIndexes.insert(version->assets);
+			queue("asset_indexes", version->assets + ".json",
+				  QUrl("http://" + URLConstants::AWS_DOWNLOAD_INDEXES + version->assets +
+					   ".json"));
+		}
+	}
+
+	if (!forgeLibs.empty())
+	{
+		job->addNetAction(ForgeMirrors::make(forgeLibs, m_job,
+											 "http://files.minecraftforge.net/mirror-brand.list"));
+	}
+
+	connect(job, SIGNAL(succeeded()), SLOT(librariesFinished()));
+	connect(job, SIGNAL(failed()), SLOT(librariesFinished()));
+	connect(job, SIGNAL(progress(qint64, qint64)), SIGNAL(progress(qint64, qint64)));
+	job->start();
+}
+
+void CacheWarmer::downloadFinished(NetJobPtr job)
+{
+	m_failedFiles.append(job->getFailedFiles());
+}
+
+void CacheWarmer::librariesFinished()
+{
+	downloadFinished(m_job);
+	assetsStart();
+}
+
+void CacheWarmer::assetsStart()
+{
+	setStatus(tr("Getting the assets..."));
+	auto job = new NetJob(tr("Cache warm-up: assets"));
+	m_job.reset(job);
+
+	// objects are shared between indexes, only get them once
+	QSet<QString> queued;
+	for (auto assetName : m_assetIndexes)
+	{
+		AssetsIndex index;
+		if (!AssetsUtils::loadAssetsIndexJson("assets/indexes/" + assetName + ".json", &index))
+		{
+			m_failedIndexes.append(assetName);
+			continue;
+		}
+		for (auto object : index.objects)
+		{
+			QString hash = object.hash();
+			if (queued.contains(hash))
+				continue;
+			queued.insert(hash);
+			m_checkedObjects++;
+			QFileInfo objectFile(AssetsUtils::objectPath(object));
+			if (objectFile.isFile() && objectFile.size() == object.size)
+				continue;
+			QString objectName = hash.left(2) + "/" + hash;
+			auto objectDL =
+				Sha1Download::make(QUrl("http://" + URLConstants::RESOURCE_BASE + objectName),
+								   objectFile.filePath(), hash);
+			objectDL->m_total_progress = object.size;
+			job->addNetAction(objectDL);
+			m_queuedFiles++;
+		}
+	}
+
+	connect(job, SIGNAL(succeeded()), SLOT(assetsFinished()));
+	connect(job, SIGNAL(failed()), SLOT(assetsFinished()));
+	connect(job, SIGNAL(progress(qint64, qint64)), SIGNAL(progress(qint64, qint64)));
+	job->start();
+}
+
+void CacheWarmer::assetsFinished()
+{
+	downloadFinished(m_job);
+	m_job.reset();
+	QLOG_INFO() << summary();
+	if (m_failedFiles.size() || m_failedIndexes.size() || m_skipped.size())
+	{
+		emitFailed(summary());
+		return;
+	}
+	emitSucceeded();
+}
+
+QString CacheWarmer::summary() const
+{
+	QStringList lines;
+	lines << tr("Instances warmed up: %1").arg(m_instances.size());
+	if (m_legacyInstances)
+		lines << tr("Legacy instances (not handled): %1").arg(m_legacyInstances);
+	lines << tr("Asset objects checked: %1").arg(m_checkedObjects);
+	lines << tr("Files queued: %1").arg(m_queuedFiles);
+	lines << tr("Files downloaded: %1").arg(m_queuedFiles - m_failedFiles.size());
+	if (m_skipped.size())
+	{
+		lines << tr("Skipped instances:");
+		for (auto skipped : m_skipped)
+			lines << "  " + skipped;
+	}
+	if (m_failedFiles.size())
+	{
+		lines << tr("Failed downloads:");
+		for (auto failed : m_failedFiles)
+			lines << "  " + failed;
+	}
+	if (m_failedIndexes.size())
+	{
+		lines << tr("Asset indexes that couldn't be loaded (their objects weren't checked):");
+		for (auto failed : m_failedIndexes)
+			lines << "  " + failed;
+	}
+	return lines.join("\n");
+}
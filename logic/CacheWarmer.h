@@ -0,0 +1,78 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QStringList>
+#include <QSet>
+#include <memory>
+
+#include "logic/tasks/Task.h"
+#include "logic/net/NetJob.h"
+
+class OneSixInstance;
+
+/**
+ * Fills the shared caches (versions, libraries, assets) for all instances, without a window.
+ *
+ * The version files are updated first, one instance at a time. Then the jars, libraries and
+ * asset indexes of all instances go into one download job, and finally the asset objects of
+ * all indexes into another. Files used by several instances are only downloaded once.
+ */
+class CacheWarmer : public Task
+{
+	Q_OBJECT
+public:
+	explicit CacheWarmer(QObject *parent = 0);
+	virtual ~CacheWarmer() {};
+
+	/// human readable summary of what was done, for the console
+	QString summary() const;
+
+protected:
+	virtual void executeTask();
+
+private
+slots:
+	void versionListLoaded();
+	void updateNextVersion();
+	void versionUpdateFailed(QString reason);
+	void librariesFinished();
+	void assetsFinished();
+
+private:
+	void librariesStart();
+	void assetsStart();
+	void skipInstance(OneSixInstance *inst, QString reason);
+	void downloadFinished(NetJobPtr job);
+
+private:
+	std::unique_ptr<Task> m_versionListTask;
+	std::shared_ptr<Task> m_versionUpdateTask;
+	QList<std::shared_ptr<OneSixInstance>> m_instances;
+	int m_currentInstance = 0;
+	NetJobPtr m_job;
+
+	/// asset indexes used by the instances
+	QSet<QString> m_assetIndexes;
+	QStringList m_skipped;
+	QStringList m_failedFiles;
+	/// asset indexes that couldn't be loaded. none of their objects were queued
+	QStringList m_failedIndexes;
+	int m_queuedFiles = 0;
+	/// distinct asset objects of the indexes that could be loaded
+	int m_checkedObjects = 0;
+	int m_legacyInstances = 0;
+};
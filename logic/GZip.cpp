@@ -0,0 +1,85 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GZip.h"
+
+#include <zlib.h>
+#include <cstring>
+
+// window bits for zlib that select the gzip wrapper
+static const int gzipWindowBits = 16 + MAX_WBITS;
+static const int chunkSize = 64 * 1024;
+
+bool GZip::isCompressed(const QByteArray &data)
+{
+	return data.size() >= 2 && quint8(data[0]) == 0x1f && quint8(data[1]) == 0x8b;
+}
+
+bool GZip::unzip(const QByteArray &compressedBytes, QByteArray &uncompressedBytes)
+{
+	uncompressedBytes.clear();
+	if (compressedBytes.isEmpty())
+		return true;
+
+	z_stream strm;
+	memset(&strm, 0, sizeof(strm));
+	if (inflateInit2(&strm, gzipWindowBits) != Z_OK)
+		return false;
+	strm.next_in = (Bytef *)compressedBytes.constData();
+	strm.avail_in = compressedBytes.size();
+
+	// metadata compresses well, start with a decent guess
+	uncompressedBytes.resize(compressedBytes.size() * 4);
+	int ret;
+	do
+	{
+		if (strm.total_out >= uLong(uncompressedBytes.size()))
+			uncompressedBytes.resize(uncompressedBytes.size() * 2);
+		strm.next_out = (Bytef *)uncompressedBytes.data() + strm.total_out;
+		strm.avail_out = uncompressedBytes.size() - strm.total_out;
+		ret = inflate(&strm, Z_NO_FLUSH);
+	} while (ret == Z_OK);
+
+	uncompressedBytes.resize(strm.total_out);
+	inflateEnd(&strm);
+	// anything but a complete stream is broken
+	return ret == Z_STREAM_END && strm.avail_in == 0;
+}
+
+bool GZip::zip(const QByteArray &uncompressedBytes, QByteArray &compressedBytes)
+{
+	compressedBytes.clear();
+
+	z_stream strm;
+	memset(&strm, 0, sizeof(strm));
+	if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, gzipWindowBits, 8,
+					 Z_DEFAULT_STRATEGY) != Z_OK)
+		return false;
+	strm.next_in = (Bytef *)uncompressedBytes.constData();
+	strm.avail_in = uncompressedBytes.size();
+
+	int ret;
+	do
+	{
+		compressedBytes.resize(strm.total_out + chunkSize);
+		strm.next_out = (Bytef *)compressedBytes.data() + strm.total_out;
+		strm.avail_out = chunkSize;
+		ret = deflate(&strm, Z_FINISH);
+	} while (ret == Z_OK);
+
+	compressedBytes.resize(strm.total_out);
+	deflateEnd(&strm);
+	return ret == Z_STREAM_END;
+}
@@ -0,0 +1,28 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QByteArray>
+
+/// gzip streams in memory, for the things we keep compressed on disk
+class GZip
+{
+public:
+	/// true if the data starts like a gzip stream
+	static bool isCompressed(const QByteArray &data);
+	static bool unzip(const QByteArray &compressedBytes, QByteArray &uncompressedBytes);
+	static bool zip(const QByteArray &uncompressedBytes, QByteArray &compressedBytes);
+};
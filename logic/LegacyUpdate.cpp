@@ -110,6 +110,7 @@ void LegacyUpdate::fmllibsStart()
 	// download missing libs to our place
 	setStatus(tr("Dowloading FML libraries..."));
 	auto dljob = new NetJob("FML libraries");
+	dljob->setPriority(Priority_Critical);
 	auto metacache = MMC->metacache();
 	for (auto &lib : fmlLibsToProcess)
 	{
@@ -375,6 +376,7 @@ void LegacyUpdate::jarStart()
 	QString urlstr = "http://" + URLConstants::AWS_DOWNLOAD_VERSIONS + localPath;
 
 	auto dljob = new NetJob("Minecraft.jar for version " + version_id);
+	dljob->setPriority(Priority_Critical);
 
 	auto metacache = MMC->metacache();
 	auto entry = metacache->resolveEntry("versions", localPath);
@@ -1,4 +1,5 @@
 #include "MMCJson.h"
+#include "GZip.h"
 
 #include <QString>
 #include <QUrl>
@@ -99,7 +100,16 @@ QJsonDocument MMCJson::parseFile(const QString &filename, const QString &what)
 	{
 		throw FileOpenError(f);
 	}
-	return parseDocument(f.readAll(), what);
+	QByteArray data = f.readAll();
+	// parts of the metadata cache are stored compressed
+	if (GZip::isCompressed(data))
+	{
+		QByteArray uncompressed;
+		if (!GZip::unzip(data, uncompressed))
+			throw JSONValidationError(what + " is compressed, but can't be decompressed");
+		data = uncompressed;
+	}
+	return parseDocument(data, what);
 }
 
 int MMCJson::ensureInteger(const QJsonValue val, QString what, const int def)
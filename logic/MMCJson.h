@@ -29,7 +29,7 @@ namespace MMCJson
 /// parses the data into a json document. throws if there's a parse error
 QJsonDocument parseDocument(const QByteArray &data, const QString &what);
 
-/// tries to open and then parses the specified file. throws if there's an error
+/// tries to open and then parses the specified file, which may be gzip compressed. throws if there's an error
 QJsonDocument parseFile(const QString &filename, const QString &what);
 
 /// make sure the value exists. throw otherwise.
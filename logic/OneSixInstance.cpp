@@ -14,6 +14,8 @@
  */
 
 #include <QIcon>
+#include <QCryptographicHash>
+#include <QtConcurrentMap>
 #include <pathutils.h>
 #include "logger/QsLog.h"
 #include "MultiMC.h"
@@ -119,6 +121,36 @@ QString replaceTokensIn(QString text, QMap<QString, QString> with)
 	return result;
 }
 
+namespace
+{
+struct AssetLink
+{
+	QString original_path;
+	QString target_path;
+};
+
+// runs on the thread pool. false if the asset isn't in the virtual folder afterwards
+bool linkAsset(const AssetLink &link)
+{
+	if (!QFile::exists(link.original_path))
+		return false;
+	QFileInfo target(link.target_path);
+	if (target.exists())
+		return true;
+	// a symbolic link to an object that is gone
+	if (target.isSymLink())
+		QFile::remove(link.target_path);
+	if (!ensureFilePathExists(link.target_path))
+		return false;
+	if (!linkOrCopyFile(link.original_path, link.target_path))
+	{
+		QLOG_WARN() << "Couldn't put" << link.original_path << "at" << link.target_path;
+		return false;
+	}
+	return true;
+}
+}
+
 QDir OneSixInstance::reconstructAssets(std::shared_ptr<InstanceVersion> version)
 {
 	QDir assetsDir = QDir("assets/");
@@ -139,6 +171,28 @@ QDir OneSixInstance::reconstructAssets(std::shared_ptr<InstanceVersion> version)
 	QLOG_DEBUG() << "reconstructAssets" << assetsDir.path() << indexDir.path()
 				 << objectDir.path() << virtualDir.path() << virtualRoot.path();
 
+	// the marker holds the hash of the index the folder was completed for
+	QString indexHash;
+	if (indexFile.open(QIODevice::ReadOnly))
+	{
+		indexHash = QCryptographicHash::hash(indexFile.readAll(), QCryptographicHash::Md5).toHex();
+		indexFile.close();
+	}
+	QFile marker(PathCombine(virtualRoot.path(), ".lastused"));
+	if (!indexHash.isEmpty() && marker.open(QIODevice::ReadOnly))
+	{
+		bool complete = marker.readAll().trimmed() == indexHash.toLatin1();
+		marker.close();
+		if (complete)
+		{
+			QLOG_INFO() << "Virtual assets folder" << virtualRoot.path() << "is up to date";
+			// rewriting it keeps the time of the last use
+			if (marker.open(QIODevice::WriteOnly | QIODevice::Truncate))
+				marker.write(indexHash.toLatin1());
+			return virtualRoot;
+		}
+	}
+
 	AssetsIndex index;
 	bool loadAssetsIndex = AssetsUtils::loadAssetsIndexJson(indexPath, &index);
 
@@ -146,34 +200,26 @@ QDir OneSixInstance::reconstructAssets(std::shared_ptr<InstanceVersion> version)
 	{
 		QLOG_INFO() << "Reconstructing virtual assets folder at" << virtualRoot.path();
 
-		for (QString map : index.objects.keys())
+		QList<AssetLink> links;
+		for (auto asset_object : index.objects)
 		{
-			AssetObject asset_object = index.objects.value(map);
-			QString target_path = PathCombine(virtualRoot.path(), map);
-			QFile target(target_path);
-
-			QString tlk = asset_object.hash.left(2);
-
-			QString original_path =
-				PathCombine(PathCombine(objectDir.path(), tlk), asset_object.hash);
-			QFile original(original_path);
-			if (!original.exists())
-				continue;
-			if (!target.exists())
-			{
-				QFileInfo info(target_path);
-				QDir target_dir = info.dir();
-				// QLOG_DEBUG() << target_dir;
-				if (!target_dir.exists())
-					QDir("").mkpath(target_dir.path());
-
-				bool couldCopy = original.copy(target_path);
-				QLOG_DEBUG() << " Copying" << original_path << "to" << target_path
-							 << QString::number(couldCopy); // << original.errorString();
-			}
+			QString hash = asset_object.hash();
+			QString original_path = PathCombine(PathCombine(objectDir.path(), hash.left(2)), hash);
+			links.append({original_path, PathCombine(virtualRoot.path(), index.name(asset_object))});
 		}
 
-		// TODO: Write last used time to virtualRoot/.lastused
+		// the objects are linked where the filesystem allows it, copied otherwise
+		auto results = QtConcurrent::blockingMapped<QList<bool>>(links, linkAsset);
+		int missing = results.count(false);
+		if (missing)
+		{
+			// try again next time, maybe they're there by then
+			QLOG_WARN() << missing << "assets are missing from" << virtualRoot.path();
+		}
+		else if (!indexHash.isEmpty() && marker.open(QIODevice::WriteOnly | QIODevice::Truncate))
+		{
+			marker.write(indexHash.toLatin1());
+		}
 	}
 
 	return virtualRoot;
@@ -22,6 +22,8 @@
 #include <QFileInfo>
 #include <QTextStream>
 #include <QDataStream>
+#include <QDateTime>
+#include <QtConcurrent>
 #include <pathutils.h>
 #include <JlCompress.h>
 
@@ -33,6 +35,7 @@
 #include "logic/forge/ForgeMirrors.h"
 #include "logic/net/URLConstants.h"
 #include "logic/assets/AssetsUtils.h"
+#include "logic/net/Sha1Download.h"
 #include "JarUtils.h"
 
 OneSixUpdate::OneSixUpdate(OneSixInstance *inst, QObject *parent) : Task(parent), m_inst(inst)
@@ -84,6 +87,12 @@ void OneSixUpdate::versionUpdateFailed(QString reason)
 	emitFailed(reason);
 }
 
+/// touched after every successful check of the objects of an asset index
+static QString verifiedMarkerPath(const QString &assetName)
+{
+	return "assets/indexes/" + assetName + ".verified";
+}
+
 void OneSixUpdate::assetIndexStart()
 {
 	setStatus(tr("Updating assets index..."));
@@ -93,6 +102,7 @@ void OneSixUpdate::assetIndexStart()
 	QUrl indexUrl = "http://" + URLConstants::AWS_DOWNLOAD_INDEXES + assetName + ".json";
 	QString localPath = assetName + ".json";
 	auto job = new NetJob(tr("Asset index for %1").arg(inst->name()));
+	job->setPriority(Priority_Critical);
 
 	auto metacache = MMC->metacache();
 	auto entry = metacache->resolveEntry("asset_indexes", localPath);
@@ -119,37 +129,92 @@ void OneSixUpdate::assetIndexFinished()
 	if (!AssetsUtils::loadAssetsIndexJson(asset_fname, &index))
 	{
 		emitFailed(tr("Failed to read the assets index!"));
+		return;
+	}
+
+	// objects that didn't change since the last verification are trusted, the rest is hashed
+	QFileInfo marker(verifiedMarkerPath(assetName));
+	QDateTime verifiedAt = marker.exists() ? marker.lastModified() : QDateTime();
+
+	// the same object can be in the index under several names
+	QMap<QString, AssetObject> objects;
+	for (auto object : index.objects)
+	{
+		objects.insert(object.hash(), object);
 	}
 
-	QList<Md5EtagDownloadPtr> dls;
-	for (auto object : index.objects.values())
+	m_assetsToFetch.clear();
+	m_assetsToVerify.clear();
+	for (auto object : objects.values())
 	{
-		QString objectName = object.hash.left(2) + "/" + object.hash;
-		QFileInfo objectFile("assets/objects/" + objectName);
+		QFileInfo objectFile(AssetsUtils::objectPath(object));
 		if ((!objectFile.isFile()) || (objectFile.size() != object.size))
 		{
-			auto objectDL = MD5EtagDownload::make(
-				QUrl("http://" + URLConstants::RESOURCE_BASE + objectName),
-				objectFile.filePath());
-			objectDL->m_total_progress = object.size;
-			dls.append(objectDL);
+			m_assetsToFetch.append(object);
 		}
+		else if (!verifiedAt.isValid() || objectFile.lastModified() >= verifiedAt)
+		{
+			m_assetsToVerify.append(object);
+		}
+	}
+
+	if (m_assetsToVerify.size())
+	{
+		setStatus(tr("Checking the assets files..."));
+		connect(&m_assetsVerifyWatcher, SIGNAL(finished()), SLOT(assetsVerified()),
+				Qt::UniqueConnection);
+		m_assetsVerifyWatcher.setFuture(
+			QtConcurrent::mapped(m_assetsToVerify, AssetsUtils::verifyObject));
+		return;
+	}
+	assetsDownloadStart();
+}
+
+void OneSixUpdate::assetsVerified()
+{
+	auto results = m_assetsVerifyWatcher.future();
+	for (int i = 0; i < m_assetsToVerify.size(); i++)
+	{
+		if (results.resultAt(i))
+			continue;
+		auto &object = m_assetsToVerify[i];
+		QLOG_WARN() << "Asset object" << object.hash() << "is corrupted, downloading it again.";
+		QFile::remove(AssetsUtils::objectPath(object));
+		m_assetsToFetch.append(object);
 	}
-	if (dls.size())
+	m_assetsToVerify.clear();
+	assetsDownloadStart();
+}
+
+void OneSixUpdate::assetsDownloadStart()
+{
+	if (m_assetsToFetch.isEmpty())
 	{
-		setStatus(tr("Getting the assets files from Mojang..."));
-		auto job = new NetJob(tr("Assets for %1").arg(inst->name()));
-		for (auto dl : dls)
-			job->addNetAction(dl);
-		jarlibDownloadJob.reset(job);
-		connect(jarlibDownloadJob.get(), SIGNAL(succeeded()), SLOT(assetsFinished()));
-		connect(jarlibDownloadJob.get(), SIGNAL(failed()), SLOT(assetsFailed()));
-		connect(jarlibDownloadJob.get(), SIGNAL(progress(qint64, qint64)),
-				SIGNAL(progress(qint64, qint64)));
-		jarlibDownloadJob->start();
+		assetsFinished();
 		return;
 	}
-	assetsFinished();
+
+	OneSixInstance *inst = (OneSixInstance *)m_inst;
+	setStatus(tr("Getting the assets files from Mojang..."));
+	auto job = new NetJob(tr("Assets for %1").arg(inst->name()));
+	job->setPriority(Priority_Critical);
+	for (auto object : m_assetsToFetch)
+	{
+		QString hash = object.hash();
+		QString objectName = hash.left(2) + "/" + hash;
+		auto objectDL =
+			Sha1Download::make(QUrl("http://" + URLConstants::RESOURCE_BASE + objectName),
+							   AssetsUtils::objectPath(object), hash);
+		objectDL->m_total_progress = object.size;
+		job->addNetAction(objectDL);
+	}
+	m_assetsToFetch.clear();
+	jarlibDownloadJob.reset(job);
+	connect(jarlibDownloadJob.get(), SIGNAL(succeeded()), SLOT(assetsFinished()));
+	connect(jarlibDownloadJob.get(), SIGNAL(failed()), SLOT(assetsFailed()));
+	connect(jarlibDownloadJob.get(), SIGNAL(progress(qint64, qint64)),
+			SIGNAL(progress(qint64, qint64)));
+	jarlibDownloadJob->start();
 }
 
 void OneSixUpdate::assetIndexFailed()
@@ -159,6 +224,14 @@ void OneSixUpdate::assetIndexFailed()
 
 void OneSixUpdate::assetsFinished()
 {
+	// everything in the store now matches the index
+	OneSixInstance *inst = (OneSixInstance *)m_inst;
+	QFile marker(verifiedMarkerPath(inst->getFullVersion()->assets));
+	if (marker.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		marker.write(QDateTime::currentDateTime().toString(Qt::ISODate).toUtf8());
+		marker.close();
+	}
 	emitSucceeded();
 }
 
@@ -189,27 +262,20 @@ void OneSixUpdate::jarlibStart()
 
 	// Build a list of URLs that will need to be downloaded.
 	std::shared_ptr<InstanceVersion> version = inst->getFullVersion();
+	QList<MetaEntryRequest> requests;
+	m_jarlibDownloads.clear();
 	// minecraft.jar for this version
 	{
 		QString version_id = version->id;
 		QString localPath = version_id + "/" + version_id + ".jar";
 		QString urlstr = "http://" + URLConstants::AWS_DOWNLOAD_VERSIONS + localPath;
-
-		auto job = new NetJob(tr("Libraries for instance %1").arg(inst->name()));
-
-		auto metacache = MMC->metacache();
-		auto entry = metacache->resolveEntry("versions", localPath);
-		job->addNetAction(CacheDownload::make(QUrl(urlstr), entry));
-		jarHashOnEntry = entry->md5sum;
-
-		jarlibDownloadJob.reset(job);
+		requests.append({"versions", localPath, QString()});
+		m_jarlibDownloads.append({QUrl(urlstr), false});
 	}
 
 	auto libs = version->getActiveNativeLibs();
 	libs.append(version->getActiveNormalLibs());
 
-	auto metacache = MMC->metacache();
-	QList<ForgeXzDownloadPtr> ForgeLibs;
 	QList<std::shared_ptr<OneSixLibrary>> brokenLocalLibs;
 
 	for (auto lib : libs)
@@ -226,18 +292,8 @@ void OneSixUpdate::jarlibStart()
 
 		auto f = [&](QString storage, QString dl)
 		{
-			auto entry = metacache->resolveEntry("libraries", storage);
-			if (entry->stale)
-			{
-				if (lib->hint() == "forge-pack-xz")
-				{
-					ForgeLibs.append(ForgeXzDownload::make(storage, entry));
-				}
-				else
-				{
-					jarlibDownloadJob->addNetAction(CacheDownload::make(dl, entry));
-				}
-			}
+			requests.append({"libraries", storage, QString()});
+			m_jarlibDownloads.append({QUrl(dl), lib->hint() == "forge-pack-xz"});
 		};
 		if (raw_storage.contains("${arch}"))
 		{
@@ -255,7 +311,6 @@ void OneSixUpdate::jarlibStart()
 	}
 	if (!brokenLocalLibs.empty())
 	{
-		jarlibDownloadJob.reset();
 		QStringList failed;
 		for (auto brokenLib : brokenLocalLibs)
 		{
@@ -268,6 +323,46 @@ void OneSixUpdate::jarlibStart()
 					  "outside of MultiMC.").arg(failed_all));
 		return;
 	}
+
+	// checking the files that changed means hashing them. don't do it on the GUI thread.
+	connect(&m_jarlibResolveWatcher, SIGNAL(finished()), SLOT(jarlibResolved()),
+			Qt::UniqueConnection);
+	m_jarlibResolveWatcher.setFuture(MMC->metacache()->resolveEntriesAsync(requests));
+}
+
+void OneSixUpdate::jarlibResolved()
+{
+	OneSixInstance *inst = (OneSixInstance *)m_inst;
+	auto entries = m_jarlibResolveWatcher.future();
+	auto job = new NetJob(tr("Libraries for instance %1").arg(inst->name()));
+	job->setPriority(Priority_Critical);
+	jarlibDownloadJob.reset(job);
+
+	QList<ForgeXzDownloadPtr> ForgeLibs;
+	for (int i = 0; i < m_jarlibDownloads.size(); i++)
+	{
+		auto entry = entries.resultAt(i);
+		auto &download = m_jarlibDownloads[i];
+		// the first one is minecraft.jar
+		if (i == 0)
+		{
+			job->addNetAction(CacheDownload::make(download.url, entry));
+			jarHashOnEntry = entry->md5sum;
+			continue;
+		}
+		if (!entry->stale)
+			continue;
+		if (download.forgeXz)
+		{
+			ForgeLibs.append(ForgeXzDownload::make(entry->path, entry));
+		}
+		else
+		{
+			job->addNetAction(CacheDownload::make(download.url, entry));
+		}
+	}
+	m_jarlibDownloads.clear();
+
 	// TODO: think about how to propagate this from the original json file... or IF AT ALL
 	QString forgeMirrorList = "http://files.minecraftforge.net/mirror-brand.list";
 	if (!ForgeLibs.empty())
@@ -393,6 +488,7 @@ void OneSixUpdate::fmllibsStart()
 	// download missing libs to our place
 	setStatus(tr("Dowloading FML libraries..."));
 	auto dljob = new NetJob("FML libraries");
+	dljob->setPriority(Priority_Critical);
 	auto metacache = MMC->metacache();
 	for (auto &lib : fmlLibsToProcess)
 	{
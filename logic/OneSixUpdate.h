@@ -18,10 +18,13 @@
 #include <QObject>
 #include <QList>
 #include <QUrl>
+#include <QFutureWatcher>
 
 #include "logic/net/NetJob.h"
 #include "logic/tasks/Task.h"
 #include "logic/VersionFilterData.h"
+#include "logic/assets/AssetsUtils.h"
+#include "logic/net/HttpMetaCache.h"
 #include <quazip.h>
 
 class MinecraftVersion;
@@ -39,6 +42,7 @@ slots:
 	void versionUpdateFailed(QString reason);
 
 	void jarlibStart();
+	void jarlibResolved();
 	void jarlibFinished();
 	void jarlibFailed();
 
@@ -50,9 +54,13 @@ slots:
 	void assetIndexFinished();
 	void assetIndexFailed();
 
+	void assetsVerified();
 	void assetsFinished();
 	void assetsFailed();
 
+private:
+	void assetsDownloadStart();
+
 private:
 	NetJobPtr jarlibDownloadJob;
 	NetJobPtr legacyDownloadJob;
@@ -65,4 +73,19 @@ private:
 	OneSixInstance *m_inst = nullptr;
 	QString jarHashOnEntry;
 	QList<FMLlib> fmlLibsToProcess;
+
+	/// where to get the jar and libraries from, in the order of the metacache requests
+	struct JarlibDownload
+	{
+		QUrl url;
+		bool forgeXz;
+	};
+	QList<JarlibDownload> m_jarlibDownloads;
+	QFutureWatcher<MetaEntryPtr> m_jarlibResolveWatcher;
+
+	/// asset objects that have to be downloaded
+	QList<AssetObject> m_assetsToFetch;
+	/// asset objects that are present, but have to be checked
+	QList<AssetObject> m_assetsToVerify;
+	QFutureWatcher<bool> m_assetsVerifyWatcher;
 };
@@ -0,0 +1,327 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "AssetsScanTask.h"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QSaveFile>
+#include <QTimer>
+#include <QCryptographicHash>
+#include <QtConcurrentMap>
+#include <QtConcurrentRun>
+#include <algorithm>
+#include <cstring>
+
+#include "logic/net/Sha1Download.h"
+#include "logic/net/URLConstants.h"
+#include "logger/QsLog.h"
+
+// objects hashed in one go, between two pauses
+static const int batchSize = 64;
+// after each batch, wait this many times as long as the batch took. 1 keeps the scan at about
+// half of what the machine could do
+static const int throttleFactor = 1;
+// what was checked so far, in case the scan is interrupted
+static const char *progressPath = "assets/.scan-progress";
+
+namespace
+{
+enum ObjectState
+{
+	ObjectGood,
+	ObjectMissing,
+	ObjectCorrupt
+};
+
+int checkObject(const AssetObject &object)
+{
+	if (AssetsUtils::verifyObject(object))
+		return ObjectGood;
+	if (!QFile::exists(AssetsUtils::objectPath(object)))
+		return ObjectMissing;
+	return ObjectCorrupt;
+}
+
+/// path of the object, relative to the object store
+QString storePath(const AssetObject &object)
+{
+	QString hash = object.hash();
+	return hash.left(2) + "/" + hash;
+}
+
+QStringList findOrphans(QSet<QString> referenced)
+{
+	QStringList orphans;
+	QDir root("assets/objects");
+	QDirIterator iter(root.path(), QDir::Files, QDirIterator::Subdirectories);
+	while (iter.hasNext())
+	{
+		QString path = root.relativeFilePath(iter.next());
+		// only objects can be orphans. downloads in progress (.part) and anything else that
+		// lives in there are left alone
+		if (!AssetsUtils::isObjectPath(path))
+			continue;
+		if (!referenced.contains(path))
+			orphans.append(path);
+	}
+	orphans.sort();
+	return orphans;
+}
+}
+
+AssetsScanTask::AssetsScanTask(bool repair, QObject *parent) : Task(parent), m_repair(repair)
+{
+	connect(&m_verifyWatcher, SIGNAL(finished()), SLOT(batchFinished()));
+	connect(&m_orphanWatcher, SIGNAL(finished()), SLOT(orphansFound()));
+}
+
+void AssetsScanTask::executeTask()
+{
+	setStatus(tr("Reading the asset indexes..."));
+	if (!loadIndexes())
+	{
+		emitFailed(tr("There are no asset indexes to check the objects against."));
+		return;
+	}
+	loadProgress();
+	if (m_position)
+		QLOG_INFO() << "Asset scan: continuing after" << m_position << "of" << m_objects.size()
+					<< "objects";
+	setStatus(tr("Checking the asset objects..."));
+	verifyBatch();
+}
+
+bool AssetsScanTask::loadIndexes()
+{
+	QDir indexDir("assets/indexes");
+	auto indexes = indexDir.entryList(QStringList() << "*.json", QDir::Files, QDir::Name);
+	if (indexes.isEmpty())
+		return false;
+	for (auto indexFile : indexes)
+	{
+		AssetsIndex index;
+		if (!AssetsUtils::loadAssetsIndexJson(indexDir.filePath(indexFile), &index))
+		{
+			QLOG_WARN() << "Asset scan: can't read the index" << indexFile;
+			m_badIndexes.append(indexFile);
+			continue;
+		}
+		m_objects += index.objects;
+	}
+
+	// objects are shared between indexes, and within them. check each one once, in a stable
+	// order so the progress can be saved as a position
+	auto less = [](const AssetObject &a, const AssetObject &b)
+	{
+		return memcmp(a.sha1, b.sha1, sizeof(a.sha1)) < 0;
+	};
+	auto same = [](const AssetObject &a, const AssetObject &b)
+	{
+		return memcmp(a.sha1, b.sha1, sizeof(a.sha1)) == 0;
+	};
+	std::sort(m_objects.begin(), m_objects.end(), less);
+	m_objects.erase(std::unique(m_objects.begin(), m_objects.end(), same), m_objects.end());
+
+	QCryptographicHash fingerprint(QCryptographicHash::Md5);
+	for (auto &object : m_objects)
+	{
+		fingerprint.addData((const char *)object.sha1, sizeof(object.sha1));
+	}
+	m_fingerprint = fingerprint.result().toHex();
+	return true;
+}
+
+void AssetsScanTask::loadProgress()
+{
+	QFile file(progressPath);
+	if (!file.open(QIODevice::ReadOnly))
+		return;
+	// the first line says which objects the progress is about
+	if (file.readLine().trimmed() != m_fingerprint)
+	{
+		QLOG_INFO() << "Asset scan: the indexes changed, starting over";
+		return;
+	}
+	bool ok = false;
+	int position = file.readLine().trimmed().toInt(&ok);
+	if (!ok || position < 0 || position > m_objects.size())
+		return;
+	QStringList missing, corrupt;
+	while (!file.atEnd())
+	{
+		QList<QByteArray> parts = file.readLine().trimmed().split(' ');
+		if (parts.size() != 2)
+			return;
+		if (parts[0] == "missing")
+			missing.append(QString::fromUtf8(parts[1]));
+		else if (parts[0] == "corrupt")
+			corrupt.append(QString::fromUtf8(parts[1]));
+		else
+			return;
+	}
+	m_position = position;
+	m_missing = missing;
+	m_corrupt = corrupt;
+}
+
+void AssetsScanTask::saveProgress()
+{
+	QSaveFile file(progressPath);
+	if (!file.open(QIODevice::WriteOnly))
+		return;
+	QByteArray data = m_fingerprint + "\n" + QByteArray::number(m_position) + "\n";
+	for (auto path : m_missing)
+		data += "missing " + path.toUtf8() + "\n";
+	for (auto path : m_corrupt)
+		data += "corrupt " + path.toUtf8() + "\n";
+	file.write(data);
+	// losing the progress only means checking some objects again
+	if (!file.commit())
+		QLOG_WARN() << "Asset scan: can't save the progress to" << progressPath;
+}
+
+void AssetsScanTask::verifyBatch()
+{
+	if (m_position >= m_objects.size())
+	{
+		setStatus(tr("Looking for orphaned objects..."));
+		if (!m_badIndexes.isEmpty())
+		{
+			// anything those indexes list would look orphaned
+			orphansFound();
+			return;
+		}
+		QSet<QString> referenced;
+		for (auto &object : m_objects)
+			referenced.insert(storePath(object));
+		m_orphanWatcher.setFuture(QtConcurrent::run(findOrphans, referenced));
+		return;
+	}
+	m_batchSize = qMin(batchSize, m_objects.size() - m_position);
+	m_batchClock.start();
+	m_verifyWatcher.setFuture(
+		QtConcurrent::mapped(m_objects.mid(m_position, m_batchSize), checkObject));
+}
+
+void AssetsScanTask::batchFinished()
+{
+	auto results = m_verifyWatcher.future().results();
+	for (int i = 0; i < results.size(); i++)
+	{
+		auto &object = m_objects[m_position + i];
+		if (results[i] == ObjectMissing)
+			m_missing.append(storePath(object));
+		else if (results[i] == ObjectCorrupt)
+			m_corrupt.append(storePath(object));
+	}
+	m_position += m_batchSize;
+	saveProgress();
+	setProgress(m_position * 100 / m_objects.size());
+
+	int pause = m_position < m_objects.size() ? m_batchClock.elapsed() * throttleFactor : 0;
+	QTimer::singleShot(pause, this, SLOT(verifyBatch()));
+}
+
+void AssetsScanTask::orphansFound()
+{
+	if (m_badIndexes.isEmpty())
+		m_orphaned = m_orphanWatcher.result();
+	if (m_repair && (m_missing.size() || m_corrupt.size()))
+	{
+		repair();
+		return;
+	}
+	finish();
+}
+
+void AssetsScanTask::repair()
+{
+	setStatus(tr("Downloading the missing and damaged objects..."));
+	auto job = new NetJob(tr("Asset repair"));
+	m_job.reset(job);
+
+	QSet<QString> bad = (m_missing + m_corrupt).toSet();
+	for (auto &object : m_objects)
+	{
+		QString path = storePath(object);
+		if (!bad.contains(path))
+			continue;
+		// a damaged object is only replaced once the new one checks out
+		auto objectDL = Sha1Download::make(QUrl("http://" + URLConstants::RESOURCE_BASE + path),
+										   AssetsUtils::objectPath(object), object.hash());
+		objectDL->m_total_progress = object.size;
+		job->addNetAction(objectDL);
+	}
+
+	connect(job, SIGNAL(succeeded()), SLOT(repairFinished()));
+	connect(job, SIGNAL(failed()), SLOT(repairFinished()));
+	connect(job, SIGNAL(progress(qint64, qint64)), SIGNAL(progress(qint64, qint64)));
+	job->start();
+}
+
+void AssetsScanTask::repairFinished()
+{
+	m_failedRepairs = m_job->getFailedFiles();
+	m_repaired = m_job->size() - m_failedRepairs.size();
+	m_job.reset();
+	finish();
+}
+
+void AssetsScanTask::finish()
+{
+	// the scan is complete, the next one starts from the beginning
+	QFile::remove(progressPath);
+	QLOG_INFO() << summary();
+
+	bool broken = m_missing.size() || m_corrupt.size();
+	if (!m_badIndexes.isEmpty() || m_failedRepairs.size() || (broken && !m_repair))
+	{
+		emitFailed(summary());
+		return;
+	}
+	emitSucceeded();
+}
+
+QString AssetsScanTask::summary() const
+{
+	QStringList lines;
+	lines << tr("Asset objects checked: %1").arg(m_objects.size());
+	for (auto index : m_badIndexes)
+		lines << "  " + tr("Unreadable index: %1").arg(index);
+
+	auto list = [&lines](QString title, const QStringList &paths)
+	{
+		lines << title;
+		for (auto path : paths)
+			lines << "    " + path;
+	};
+	list(tr("Missing: %1").arg(m_missing.size()), m_missing);
+	list(tr("Damaged: %1").arg(m_corrupt.size()), m_corrupt);
+	if (m_badIndexes.isEmpty())
+		list(tr("Orphaned (not in any index): %1").arg(m_orphaned.size()), m_orphaned);
+	else
+		lines << tr("Orphaned: not checked, some indexes can't be read");
+
+	if (m_repair && (m_missing.size() || m_corrupt.size()))
+	{
+		lines << tr("Downloaded again: %1").arg(m_repaired);
+		if (m_failedRepairs.size())
+			list(tr("Failed to download: %1").arg(m_failedRepairs.size()), m_failedRepairs);
+	}
+	return lines.join("\n");
+}
@@ -0,0 +1,103 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QStringList>
+#include <QVector>
+#include <QSet>
+#include <QFutureWatcher>
+#include <QElapsedTimer>
+
+#include "logic/tasks/Task.h"
+#include "logic/net/NetJob.h"
+#include "AssetsUtils.h"
+
+/**
+ * Checks the shared asset object store against all the indexes in assets/indexes.
+ *
+ * Every object an index lists is hashed, a few at a time on worker threads, with a pause
+ * after each batch so the scan can run next to other work. What was checked so far is kept in
+ * assets/.scan-progress, so an interrupted scan continues where it stopped as long as the
+ * indexes didn't change. Files in the store that no index lists are reported as orphaned, but
+ * left alone, the cache collector takes care of those.
+ *
+ * With repair, the missing and damaged objects are downloaded again, all in one job.
+ */
+class AssetsScanTask : public Task
+{
+	Q_OBJECT
+public:
+	explicit AssetsScanTask(bool repair, QObject *parent = 0);
+	virtual ~AssetsScanTask() {};
+
+	/// human readable report, for the console
+	QString summary() const;
+
+	/// the objects that aren't there or don't match their hash, as paths in the store
+	QStringList missing() const
+	{
+		return m_missing;
+	}
+	QStringList corrupt() const
+	{
+		return m_corrupt;
+	}
+	QStringList orphaned() const
+	{
+		return m_orphaned;
+	}
+
+protected:
+	virtual void executeTask();
+
+private
+slots:
+	void verifyBatch();
+	void batchFinished();
+	void orphansFound();
+	void repairFinished();
+
+private:
+	bool loadIndexes();
+	void loadProgress();
+	void saveProgress();
+	void repair();
+	void finish();
+
+private:
+	bool m_repair;
+
+	/// every object in the indexes, once, ordered by hash
+	QVector<AssetObject> m_objects;
+	/// identifies the set of objects, to know whether saved progress still applies
+	QByteArray m_fingerprint;
+	/// indexes that couldn't be read
+	QStringList m_badIndexes;
+
+	/// objects before this one are verified
+	int m_position = 0;
+	int m_batchSize = 0;
+	QElapsedTimer m_batchClock;
+	QFutureWatcher<int> m_verifyWatcher;
+	QFutureWatcher<QStringList> m_orphanWatcher;
+
+	QStringList m_missing;
+	QStringList m_corrupt;
+	QStringList m_orphaned;
+	int m_repaired = 0;
+	QStringList m_failedRepairs;
+	NetJobPtr m_job;
+};
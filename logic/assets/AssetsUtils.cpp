@@ -16,12 +16,479 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QCryptographicHash>
-#include <QJsonParseError>
-#include <QJsonDocument>
-#include <QJsonObject>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSaveFile>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
 
 #include "AssetsUtils.h"
 #include "MultiMC.h"
+#include <pathutils.h>
+#include "logger/QsLog.h"
+
+QString AssetObject::hash() const
+{
+	return QByteArray::fromRawData((const char *)sha1, 20).toHex();
+}
+
+QString AssetsIndex::name(const AssetObject &object) const
+{
+	return QString::fromUtf8(names.constData() + object.name_offset, object.name_length);
+}
+
+namespace
+{
+/*
+ * Reads an assets index straight into an AssetsIndex, without building a document first:
+ *
+ * {
+ *   "virtual": true,
+ *   "objects": {
+ *     "icons/icon_16x16.png": {
+ *       "hash": "bdf48ef6b5d0d23bbb02e17d04865216179f510a",
+ *       "size": 3665
+ *     },
+ *     ...
+ *   }
+ * }
+ *
+ * Anything else in the file is skipped.
+ */
+class IndexParser
+{
+public:
+	IndexParser(const char *data, qint64 size, AssetsIndex *index)
+		: m_pos(data), m_end(data + size), m_index(index)
+	{
+	}
+
+	bool parse()
+	{
+		if (!expect('{'))
+			return false;
+		if (peek('}'))
+			return finish();
+		do
+		{
+			m_scratch.clear();
+			if (!parseString(m_scratch) || !expect(':'))
+				return false;
+			if (m_scratch == "objects")
+			{
+				if (!parseObjects())
+					return false;
+			}
+			else if (m_scratch == "virtual" && peek('t'))
+			{
+				if (!literal("true"))
+					return false;
+				m_index->isVirtual = true;
+			}
+			else if (!skipValue(0))
+			{
+				return false;
+			}
+		} while (peek(','));
+		return expect('}') && finish();
+	}
+
+	/// how far the parser got, for error messages
+	qint64 offset(const char *data) const
+	{
+		return m_pos - data;
+	}
+
+private:
+	void skipSpace()
+	{
+		while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t'))
+			m_pos++;
+	}
+	/// skips the character if it's next
+	bool peek(char c)
+	{
+		skipSpace();
+		if (m_pos < m_end && *m_pos == c)
+		{
+			if (c == ',' || c == '}' || c == ']')
+				m_pos++;
+			return true;
+		}
+		return false;
+	}
+	bool expect(char c)
+	{
+		skipSpace();
+		if (m_pos >= m_end || *m_pos != c)
+			return false;
+		m_pos++;
+		return true;
+	}
+	bool literal(const char *word)
+	{
+		size_t length = strlen(word);
+		if (m_end - m_pos < qint64(length) || memcmp(m_pos, word, length) != 0)
+			return false;
+		m_pos += length;
+		return true;
+	}
+	bool finish()
+	{
+		skipSpace();
+		return m_pos == m_end;
+	}
+
+	static int hexValue(char c)
+	{
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+		return -1;
+	}
+	bool parseHex4(uint &value)
+	{
+		if (m_end - m_pos < 4)
+			return false;
+		value = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			int digit = hexValue(*m_pos++);
+			if (digit < 0)
+				return false;
+			value = (value << 4) | digit;
+		}
+		return true;
+	}
+	static void appendUtf8(QByteArray &out, uint code)
+	{
+		if (code < 0x80)
+		{
+			out.append(char(code));
+		}
+		else if (code < 0x800)
+		{
+			out.append(char(0xC0 | (code >> 6)));
+			out.append(char(0x80 | (code & 0x3F)));
+		}
+		else if (code < 0x10000)
+		{
+			out.append(char(0xE0 | (code >> 12)));
+			out.append(char(0x80 | ((code >> 6) & 0x3F)));
+			out.append(char(0x80 | (code & 0x3F)));
+		}
+		else
+		{
+			out.append(char(0xF0 | (code >> 18)));
+			out.append(char(0x80 | ((code >> 12) & 0x3F)));
+			out.append(char(0x80 | ((code >> 6) & 0x3F)));
+			out.append(char(0x80 | (code & 0x3F)));
+		}
+	}
+
+	/// appends the string to out, unescaped
+	bool parseString(QByteArray &out)
+	{
+		if (!expect('"'))
+			return false;
+		while (true)
+		{
+			// copy everything up to the next quote or escape in one go
+			const char *start = m_pos;
+			while (m_pos < m_end && *m_pos != '"' && *m_pos != '\\' && uchar(*m_pos) >= 0x20)
+				m_pos++;
+			out.append(start, m_pos - start);
+			if (m_pos >= m_end)
+				return false;
+			char c = *m_pos++;
+			if (c == '"')
+				return true;
+			if (c != '\\' || m_pos >= m_end)
+				return false;
+			switch (*m_pos++)
+			{
+			case '"':
+				out.append('"');
+				break;
+			case '\\':
+				out.append('\\');
+				break;
+			case '/':
+				out.append('/');
+				break;
+			case 'b':
+				out.append('\b');
+				break;
+			case 'f':
+				out.append('\f');
+				break;
+			case 'n':
+				out.append('\n');
+				break;
+			case 'r':
+				out.append('\r');
+				break;
+			case 't':
+				out.append('\t');
+				break;
+			case 'u':
+			{
+				uint code;
+				if (!parseHex4(code))
+					return false;
+				// a surrogate pair is two escapes
+				if (code >= 0xD800 && code < 0xDC00)
+				{
+					uint low;
+					if (!literal("\\u") || !parseHex4(low) || low < 0xDC00 || low >= 0xE000)
+						return false;
+					code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+				}
+				appendUtf8(out, code);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+	}
+
+	bool parseNumber(double &value)
+	{
+		skipSpace();
+		char buffer[64];
+		int length = 0;
+		while (m_pos < m_end && length < int(sizeof(buffer)) - 1 &&
+			   (isdigit(uchar(*m_pos)) || *m_pos == '-' || *m_pos == '+' || *m_pos == '.' ||
+				*m_pos == 'e' || *m_pos == 'E'))
+		{
+			buffer[length++] = *m_pos++;
+		}
+		buffer[length] = 0;
+		char *parsed;
+		value = strtod(buffer, &parsed);
+		return length && parsed == buffer + length;
+	}
+
+	bool skipValue(int depth)
+	{
+		// nobody nests this deep in an index
+		if (depth > 64)
+			return false;
+		skipSpace();
+		if (m_pos >= m_end)
+			return false;
+		switch (*m_pos)
+		{
+		case '"':
+			m_scratch.clear();
+			return parseString(m_scratch);
+		case '{':
+			m_pos++;
+			if (peek('}'))
+				return true;
+			do
+			{
+				m_scratch.clear();
+				if (!parseString(m_scratch) || !expect(':') || !skipValue(depth + 1))
+					return false;
+			} while (peek(','));
+			return expect('}');
+		case '[':
+			m_pos++;
+			if (peek(']'))
+				return true;
+			do
+			{
+				if (!skipValue(depth + 1))
+					return false;
+			} while (peek(','));
+			return expect(']');
+		case 't':
+			return literal("true");
+		case 'f':
+			return literal("false");
+		case 'n':
+			return literal("null");
+		default:
+			double ignored;
+			return parseNumber(ignored);
+		}
+	}
+
+	bool parseObjects()
+	{
+		if (!expect('{'))
+			return false;
+		if (peek('}'))
+			return true;
+		do
+		{
+			AssetObject object;
+			// the name goes right into the shared buffer
+			object.name_offset = m_index->names.size();
+			if (!parseString(m_index->names))
+				return false;
+			object.name_length = m_index->names.size() - object.name_offset;
+			if (!expect(':') || !parseObject(object))
+				return false;
+			m_index->objects.append(object);
+		} while (peek(','));
+		return expect('}');
+	}
+
+	bool parseObject(AssetObject &object)
+	{
+		if (!expect('{'))
+			return false;
+		bool hasHash = false;
+		if (!peek('}'))
+		{
+			do
+			{
+				m_scratch.clear();
+				if (!parseString(m_scratch) || !expect(':'))
+					return false;
+				if (m_scratch == "hash")
+				{
+					m_scratch.clear();
+					if (!parseString(m_scratch) || m_scratch.size() != 40)
+						return false;
+					for (int i = 0; i < 20; i++)
+					{
+						int high = hexValue(m_scratch[2 * i]);
+						int low = hexValue(m_scratch[2 * i + 1]);
+						if (high < 0 || low < 0)
+							return false;
+						object.sha1[i] = (high << 4) | low;
+					}
+					hasHash = true;
+				}
+				else if (m_scratch == "size")
+				{
+					double size;
+					if (!parseNumber(size))
+						return false;
+					object.size = qint64(size);
+				}
+				else if (!skipValue(1))
+				{
+					return false;
+				}
+			} while (peek(','));
+			if (!expect('}'))
+				return false;
+		}
+		return hasHash;
+	}
+
+private:
+	const char *m_pos;
+	const char *m_end;
+	AssetsIndex *m_index;
+	/// keys and skipped strings, reused so they don't allocate every time
+	QByteArray m_scratch;
+};
+
+/*
+ * The parsed form of an index. It is a header, the objects, and then the names:
+ *
+ * magic "MMCAIDX1", MD5 of the JSON (16 bytes), size and modification time of the JSON
+ * (64 bit each), flags, object count, size of the names (32 bit each), 32 bits of padding
+ *
+ * Every object is its SHA-1 (20 bytes), name offset, name length, 32 bits of padding, and
+ * size (64 bit). Numbers are in the byte order of the machine, this is only a cache.
+ */
+static const char parsedMagic[] = "MMCAIDX1";
+static const int parsedHeaderSize = 8 + 16 + 8 + 8 + 4 + 4 + 4 + 4;
+static const int parsedObjectSize = 20 + 4 + 4 + 4 + 8;
+static const quint32 parsedVirtual = 1;
+
+struct ParsedHeader
+{
+	QByteArray md5;
+	qint64 source_size;
+	qint64 source_modified;
+	quint32 flags;
+	quint32 count;
+	quint32 names_size;
+};
+
+QString parsedIndexPath(const QString &path)
+{
+	QFileInfo info(path);
+	return PathCombine(info.path(), "parsed", info.completeBaseName() + ".bin");
+}
+
+bool readParsedHeader(const uchar *data, qint64 size, ParsedHeader &header)
+{
+	if (size < parsedHeaderSize || memcmp(data, parsedMagic, 8) != 0)
+		return false;
+	header.md5 = QByteArray((const char *)data + 8, 16);
+	memcpy(&header.source_size, data + 24, 8);
+	memcpy(&header.source_modified, data + 32, 8);
+	memcpy(&header.flags, data + 40, 4);
+	memcpy(&header.count, data + 44, 4);
+	memcpy(&header.names_size, data + 48, 4);
+	return size == parsedHeaderSize + qint64(header.count) * parsedObjectSize + header.names_size;
+}
+
+bool readParsedIndex(const uchar *data, const ParsedHeader &header, AssetsIndex *index)
+{
+	index->isVirtual = header.flags & parsedVirtual;
+	index->objects.resize(header.count);
+	const uchar *record = data + parsedHeaderSize;
+	for (quint32 i = 0; i < header.count; i++, record += parsedObjectSize)
+	{
+		AssetObject &object = index->objects[i];
+		memcpy(object.sha1, record, 20);
+		memcpy(&object.name_offset, record + 20, 4);
+		memcpy(&object.name_length, record + 24, 4);
+		memcpy(&object.size, record + 32, 8);
+		if (qint64(object.name_offset) + object.name_length > header.names_size)
+			return false;
+	}
+	index->names = QByteArray((const char *)record, header.names_size);
+	return true;
+}
+
+void writeParsedIndex(const QString &path, const ParsedHeader &header, const AssetsIndex &index)
+{
+	QByteArray data(parsedHeaderSize + index.objects.size() * parsedObjectSize, 0);
+	uchar *out = (uchar *)data.data();
+	quint32 count = index.objects.size();
+	quint32 names_size = index.names.size();
+	quint32 flags = index.isVirtual ? parsedVirtual : 0;
+	memcpy(out, parsedMagic, 8);
+	memcpy(out + 8, header.md5.constData(), 16);
+	memcpy(out + 24, &header.source_size, 8);
+	memcpy(out + 32, &header.source_modified, 8);
+	memcpy(out + 40, &flags, 4);
+	memcpy(out + 44, &count, 4);
+	memcpy(out + 48, &names_size, 4);
+	uchar *record = out + parsedHeaderSize;
+	for (auto &object : index.objects)
+	{
+		memcpy(record, object.sha1, 20);
+		memcpy(record + 20, &object.name_offset, 4);
+		memcpy(record + 24, &object.name_length, 4);
+		memcpy(record + 32, &object.size, 8);
+		record += parsedObjectSize;
+	}
+	data.append(index.names);
+
+	// it's only a cache, if it can't be written the JSON is parsed again next time
+	if (!ensureFilePathExists(path))
+		return;
+	QSaveFile file(path);
+	if (file.open(QIODevice::WriteOnly) && file.write(data) == data.size())
+		file.commit();
+}
+}
 
 namespace AssetsUtils
 {
@@ -58,24 +525,45 @@ int findLegacyAssets()
 	return found;
 }
 
+bool parseAssetsIndex(const char *data, qint64 size, AssetsIndex *index)
+{
+	index->objects.clear();
+	index->names.clear();
+	index->isVirtual = false;
+	IndexParser parser(data, size, index);
+	if (!parser.parse())
+	{
+		QLOG_ERROR() << "Failed to parse assets index at offset" << parser.offset(data);
+		return false;
+	}
+	return true;
+}
+
 /*
  * Returns true on success, with index populated
  * index is undefined otherwise
  */
 bool loadAssetsIndexJson(QString path, AssetsIndex *index)
 {
-	/*
+	QFileInfo info(path);
+	qint64 modified = info.lastModified().toMSecsSinceEpoch();
+	QString parsedPath = parsedIndexPath(path);
+
+	// the parsed form is current if it was made from a file that looks the same
+	QFile parsedFile(parsedPath);
+	const uchar *parsed = nullptr;
+	ParsedHeader header;
+	if (parsedFile.open(QIODevice::ReadOnly))
 	{
-	  "objects": {
-		"icons/icon_16x16.png": {
-		  "hash": "bdf48ef6b5d0d23bbb02e17d04865216179f510a",
-		  "size": 3665
-		},
-		...
-		}
-	  }
+		parsed = parsedFile.map(0, parsedFile.size());
+		if (parsed && !readParsedHeader(parsed, parsedFile.size(), header))
+			parsed = nullptr;
+	}
+	if (parsed && header.source_size == info.size() && header.source_modified == modified &&
+		readParsedIndex(parsed, header, index))
+	{
+		return true;
 	}
-	*/
 
 	QFile file(path);
 
@@ -87,68 +575,75 @@ bool loadAssetsIndexJson(QString path, AssetsIndex *index)
 		return false;
 	}
 
-	// Read the file and close it.
-	QByteArray jsonData = file.readAll();
-	file.close();
-
-	QJsonParseError parseError;
-	QJsonDocument jsonDoc = QJsonDocument::fromJson(jsonData, &parseError);
+	QByteArray jsonData;
+	const char *data = nullptr;
+	qint64 size = file.size();
+	if (size)
+	{
+		data = (const char *)file.map(0, size);
+		if (!data)
+		{
+			jsonData = file.readAll();
+			data = jsonData.constData();
+			size = jsonData.size();
+		}
+	}
+	QByteArray md5 = QCryptographicHash::hash(QByteArray::fromRawData(data, size),
+											  QCryptographicHash::Md5);
 
-	// Fail if the JSON is invalid.
-	if (parseError.error != QJsonParseError::NoError)
+	// touched, but still the same index
+	if (parsed && header.md5 == md5 && readParsedIndex(parsed, header, index))
 	{
-		QLOG_ERROR() << "Failed to parse assets index file:" << parseError.errorString()
-					 << "at offset " << QString::number(parseError.offset);
-		return false;
+		return true;
 	}
+	parsedFile.close();
 
-	// Make sure the root is an object.
-	if (!jsonDoc.isObject())
+	if (!parseAssetsIndex(data, size, index))
 	{
-		QLOG_ERROR() << "Invalid assets index JSON: Root should be an array.";
+		QLOG_ERROR() << "Failed to parse assets index file" << path;
 		return false;
 	}
+	writeParsedIndex(parsedPath, ParsedHeader{md5, size, modified, 0, 0, 0}, *index);
+	return true;
+}
 
-	QJsonObject root = jsonDoc.object();
+QString objectPath(const AssetObject &object)
+{
+	QString hash = object.hash();
+	return "assets/objects/" + hash.left(2) + "/" + hash;
+}
 
-	QJsonValue isVirtual = root.value("virtual");
-	if (!isVirtual.isUndefined())
+bool isObjectPath(const QString &path)
+{
+	if (path.size() != 43 || path[2] != '/' || path.left(2) != path.mid(3, 2))
+		return false;
+	for (int i = 3; i < path.size(); i++)
 	{
-		index->isVirtual = isVirtual.toBool(false);
+		QChar c = path[i];
+		if (!(c >= '0' && c <= '9') && !(c >= 'a' && c <= 'f'))
+			return false;
 	}
+	return true;
+}
 
-	QJsonValue objects = root.value("objects");
-	QVariantMap map = objects.toVariant().toMap();
+bool verifyObject(const AssetObject &object)
+{
+	QFile file(objectPath(object));
+	if (file.size() != object.size)
+		return false;
+	if (!file.open(QIODevice::ReadOnly))
+		return false;
 
-	for (QVariantMap::const_iterator iter = map.begin(); iter != map.end(); ++iter)
+	// hash in chunks, some of the objects (music, sounds) are big
+	QCryptographicHash sha1(QCryptographicHash::Sha1);
+	char buffer[64 * 1024];
+	qint64 read;
+	while ((read = file.read(buffer, sizeof(buffer))) > 0)
 	{
-		// QLOG_DEBUG() << iter.key();
-
-		QVariant variant = iter.value();
-		QVariantMap nested_objects = variant.toMap();
-
-		AssetObject object;
-
-		for (QVariantMap::const_iterator nested_iter = nested_objects.begin();
-			 nested_iter != nested_objects.end(); ++nested_iter)
-		{
-			// QLOG_DEBUG() << nested_iter.key() << nested_iter.value().toString();
-			QString key = nested_iter.key();
-			QVariant value = nested_iter.value();
-
-			if (key == "hash")
-			{
-				object.hash = value.toString();
-			}
-			else if (key == "size")
-			{
-				object.size = value.toDouble();
-			}
-		}
-
-		index->objects.insert(iter.key(), object);
+		sha1.addData(buffer, read);
 	}
-
-	return true;
+	if (read < 0)
+		return false;
+	return sha1.result() == QByteArray::fromRawData((const char *)object.sha1, 20);
 }
 }
@@ -16,22 +16,45 @@
 #pragma once
 
 #include <QString>
-#include <QMap>
+#include <QByteArray>
+#include <QVector>
 
 struct AssetObject
 {
-	QString hash;
-	qint64 size;
+	/// SHA-1 of the object
+	quint8 sha1[20];
+	qint64 size = 0;
+	/// where the name of the object is in AssetsIndex::names
+	quint32 name_offset = 0;
+	quint32 name_length = 0;
+
+	/// the SHA-1 in lower case hex, which is also the file name of the object
+	QString hash() const;
 };
 
 struct AssetsIndex
 {
-	QMap<QString, AssetObject> objects;
+	/// one for every name. The same object can be listed under several names.
+	QVector<AssetObject> objects;
+	/// the names of all the objects, UTF-8, back to back
+	QByteArray names;
 	bool isVirtual = false;
+
+	QString name(const AssetObject &object) const;
 };
 
 namespace AssetsUtils
 {
+/// loads the index, from its parsed form next to it if that is still current
 bool loadAssetsIndexJson(QString file, AssetsIndex* index);
+/// parses an index from JSON. The index is undefined if this fails.
+bool parseAssetsIndex(const char *data, qint64 size, AssetsIndex *index);
 int findLegacyAssets();
+/// path of the object in the object store, relative to the data folder
+QString objectPath(const AssetObject &object);
+/// is this where an object would be stored, relative to the object store?
+/// ("ab/ab0123...", 40 lower case hex digits)
+bool isObjectPath(const QString &path);
+/// checks the size and SHA-1 of a stored object. Safe to call from worker threads.
+bool verifyObject(const AssetObject &object);
 }
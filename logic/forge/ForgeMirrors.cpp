@@ -1,9 +1,17 @@
 #include "MultiMC.h"
 #include "ForgeMirrors.h"
 #include "logger/QsLog.h"
+#include "logic/settings/SettingsObject.h"
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <algorithm>
 #include <random>
 
+// how long the mirrors get to answer the latency probe
+static const int probeTimeout = 3000;
+// weight of the newest probe in the remembered latency
+static const double latencySmoothing = 0.5;
+
 ForgeMirrors::ForgeMirrors(QList<ForgeXzDownloadPtr> &libs, NetJobPtr parent_job,
 						   QString mirrorlist)
 {
@@ -11,6 +19,9 @@ ForgeMirrors::ForgeMirrors(QList<ForgeXzDownloadPtr> &libs, NetJobPtr parent_job
 	m_parent_job = parent_job;
 	m_url = QUrl(mirrorlist);
 	m_status = Job_NotStarted;
+	m_probe_timer.setSingleShot(true);
+	m_probe_timer.setInterval(probeTimeout);
+	connect(&m_probe_timer, SIGNAL(timeout()), SLOT(probeTimeout()));
 }
 
 void ForgeMirrors::start()
@@ -67,8 +78,7 @@ void ForgeMirrors::deferToFixedList()
 					  "http://files.minecraftforge.net/forge_logo.png",
 					  "https://www.creeperhost.net/link.php?id=1",
 					  "http://new.creeperrepo.net/forge/maven/"});
-	injectDownloads();
-	emit succeeded(m_index_within_job);
+	probeMirrors();
 }
 
 void ForgeMirrors::parseMirrorList()
@@ -86,18 +96,133 @@ void ForgeMirrors::parseMirrorList()
 		}
 	}
 	if(!m_mirrors.size())
+	{
 		deferToFixedList();
+		return;
+	}
+	probeMirrors();
+}
+
+void ForgeMirrors::probeMirrors()
+{
+	if (m_libs.isEmpty() || m_mirrors.size() < 2)
+	{
+		rankMirrors();
+		injectDownloads();
+		emit succeeded(m_index_within_job);
+		return;
+	}
+
+	// ask every mirror for the first library at once and see who answers first
+	QLOG_INFO() << "Probing" << m_mirrors.size() << "Forge mirrors";
+	m_probe_results.clear();
+	m_probe_clock.start();
+	auto worker = MMC->qnam();
+	for (int i = 0; i < m_mirrors.size(); i++)
+	{
+		QNetworkRequest request(
+			QUrl(m_mirrors[i].mirror_url + m_libs[0]->m_url_path + ".pack.xz"));
+		request.setHeader(QNetworkRequest::UserAgentHeader, "MultiMC/5.0 (Uncached)");
+		QNetworkReply *rep = worker->head(request);
+		rep->setProperty("mirror", i);
+		connect(rep, SIGNAL(finished()), SLOT(probeFinished()));
+		m_probes.append(rep);
+	}
+	m_probe_timer.start();
+}
+
+void ForgeMirrors::probeFinished()
+{
+	QNetworkReply *rep = qobject_cast<QNetworkReply *>(sender());
+	if (!rep || !m_probes.removeOne(rep))
+		return;
+	int index = rep->property("mirror").toInt();
+	int status = rep->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+	if (rep->error() == QNetworkReply::NoError && status < 400)
+		m_probe_results[index] = m_probe_clock.elapsed();
+	else
+		m_probe_results[index] = -1;
+	rep->deleteLater();
+
+	if (!m_probes.isEmpty())
+		return;
+	m_probe_timer.stop();
+	rankMirrors();
 	injectDownloads();
 	emit succeeded(m_index_within_job);
 }
 
-void ForgeMirrors::injectDownloads()
+void ForgeMirrors::probeTimeout()
 {
-	// shuffle the mirrors randomly
+	// the slow ones failed. aborting makes them finish right away
+	auto probes = m_probes;
+	for (auto rep : probes)
+	{
+		rep->abort();
+	}
+}
+
+void ForgeMirrors::rankMirrors()
+{
+	// merge the probe results with what we know from earlier runs
+	auto settings = MMC->settings();
+	QJsonObject ranking =
+		QJsonDocument::fromJson(settings->get("ForgeMirrorRanking").toString().toUtf8()).object();
+	for (auto iter = m_probe_results.begin(); iter != m_probe_results.end(); iter++)
+	{
+		QString key = m_mirrors[iter.key()].mirror_url;
+		QJsonObject entry = ranking.value(key).toObject();
+		if (iter.value() < 0)
+		{
+			entry.insert("failures", entry.value("failures").toInt() + 1);
+		}
+		else
+		{
+			double latency = iter.value();
+			if (entry.contains("latency"))
+			{
+				latency = entry.value("latency").toDouble() * (1.0 - latencySmoothing) +
+						  latency * latencySmoothing;
+			}
+			entry.insert("latency", latency);
+			entry.insert("failures", 0);
+		}
+		ranking.insert(key, entry);
+	}
+
+	// shuffle first, so mirrors we know nothing about share the load
 	std::random_device rd;
 	std::mt19937 rng(rd());
 	std::shuffle(m_mirrors.begin(), m_mirrors.end(), rng);
+	// then the ones that work and answer quickly go first
+	std::stable_sort(m_mirrors.begin(), m_mirrors.end(),
+					 [&ranking](const ForgeMirror &a, const ForgeMirror &b)
+	{
+		QJsonObject ea = ranking.value(a.mirror_url).toObject();
+		QJsonObject eb = ranking.value(b.mirror_url).toObject();
+		int fa = ea.value("failures").toInt();
+		int fb = eb.value("failures").toInt();
+		if (fa != fb)
+			return fa < fb;
+		if (ea.contains("latency") != eb.contains("latency"))
+			return ea.contains("latency");
+		return ea.value("latency").toDouble() < eb.value("latency").toDouble();
+	});
+	for (auto mirror : m_mirrors)
+	{
+		QJsonObject entry = ranking.value(mirror.mirror_url).toObject();
+		QLOG_INFO() << "Forge mirror" << mirror.name << "latency:"
+					<< entry.value("latency").toDouble(-1) << "failures:"
+					<< entry.value("failures").toInt();
+	}
+	m_probe_results.clear();
+
+	settings->set("ForgeMirrorRanking",
+				  QString::fromUtf8(QJsonDocument(ranking).toJson(QJsonDocument::Compact)));
+}
 
+void ForgeMirrors::injectDownloads()
+{
 	// tell parent to download the libs
 	for(auto lib: m_libs)
 	{
@@ -21,6 +21,8 @@
 #include "logic/forge/ForgeXzDownload.h"
 #include <QFile>
 #include <QTemporaryFile>
+#include <QTimer>
+#include <QElapsedTimer>
 typedef std::shared_ptr<class ForgeMirrors> ForgeMirrorsPtr;
 
 class ForgeMirrors : public NetAction
@@ -46,12 +48,24 @@ slots:
 	virtual void downloadError(QNetworkReply::NetworkError error);
 	virtual void downloadFinished();
 	virtual void downloadReadyRead();
+	void probeFinished();
+	void probeTimeout();
 
 private:
 	void parseMirrorList();
 	void deferToFixedList();
+	void probeMirrors();
+	void rankMirrors();
 	void injectDownloads();
 
+private:
+	/// outstanding latency probes
+	QList<QNetworkReply *> m_probes;
+	/// measured latency of each mirror in ms, -1 if the probe failed
+	QMap<int, qint64> m_probe_results;
+	QTimer m_probe_timer;
+	QElapsedTimer m_probe_clock;
+
 public
 slots:
 	virtual void start();
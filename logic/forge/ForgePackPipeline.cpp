@@ -0,0 +1,431 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ForgePackPipeline.h"
+
+#include <QCoreApplication>
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QCryptographicHash>
+#include <QList>
+#include <stdexcept>
+
+#include "xz.h"
+#include "unpack200.h"
+#include <pathutils.h>
+#include "logger/QsLog.h"
+
+// compressed data the pipe holds while a worker is on it
+static const qint64 pipeSize = 1024 * 1024;
+// the data is handed over in pieces of this size
+static const qint64 chunkSize = 64 * 1024;
+// progress is reported after this much data, at most
+static const qint64 progressStep = 256 * 1024;
+
+// unpacking is mostly CPU work, so there is one worker per core. A worker that runs out of
+// data gives its thread back to the pool while it waits, so packs that have data don't wait
+// behind slow downloads.
+static QThreadPool *unpackPool()
+{
+	static QThreadPool *pool = nullptr;
+	if (!pool)
+	{
+		pool = new QThreadPool(QCoreApplication::instance());
+		pool->setMaxThreadCount(qMax(1, QThread::idealThreadCount()));
+	}
+	return pool;
+}
+
+struct PackPipeState
+{
+	PackPipeState() : hash(QCryptographicHash::Md5)
+	{
+	}
+
+	QMutex mutex;
+	QWaitCondition changed;
+	/// the pipeline to report to, cleared when it goes away
+	QObject *receiver = nullptr;
+	QList<QByteArray> chunks;
+	qint64 buffered = 0;
+	/// data taken by the worker, and how much of that was reported
+	qint64 consumed = 0;
+	qint64 reported = 0;
+	bool progress_pending = false;
+	/// no more data is coming
+	bool closed = false;
+	bool starved = false;
+	bool stop = false;
+	bool started = false;
+	bool done = false;
+	bool succeeded = false;
+	QString error;
+	QString md5;
+
+	/// the jar. the output is written next to it and replaces it once it's complete
+	QString target_path;
+	/// only used by the worker once it has started
+	QFile output;
+	QCryptographicHash hash;
+	xz_dec *xz = nullptr;
+	xz_buf buf;
+	QByteArray input;
+	bool xz_done = false;
+};
+
+namespace
+{
+/// call a slot of the pipeline, if it's still there. The mutex has to be held.
+void notify(PackPipeState *s, const char *slot)
+{
+	if (s->receiver)
+		QMetaObject::invokeMethod(s->receiver, slot, Qt::QueuedConnection);
+}
+
+void setError(PackPipeState *s, QString error)
+{
+	QMutexLocker locker(&s->mutex);
+	if (s->error.isEmpty())
+		s->error = error;
+}
+
+/// wait for the next piece of compressed data. false if there isn't going to be one
+bool takeInput(PackPipeState *s)
+{
+	QMutexLocker locker(&s->mutex);
+	if (s->chunks.isEmpty() && !s->closed && !s->stop)
+	{
+		// waiting for the network isn't unpacking, another pack can have the core meanwhile
+		unpackPool()->releaseThread();
+		while (s->chunks.isEmpty() && !s->closed && !s->stop)
+			s->changed.wait(&s->mutex);
+		unpackPool()->reserveThread();
+	}
+	if (s->stop)
+		return false;
+	if (s->chunks.isEmpty())
+	{
+		if (s->error.isEmpty())
+			s->error = ForgePackPipeline::tr("The download ended in the middle of the xz stream");
+		return false;
+	}
+	s->input = s->chunks.takeFirst();
+	s->buffered -= s->input.size();
+	s->consumed += s->input.size();
+	s->buf.in = (const uint8_t *)s->input.constData();
+	s->buf.in_pos = 0;
+	s->buf.in_size = s->input.size();
+
+	if (s->starved && s->buffered < pipeSize)
+	{
+		s->starved = false;
+		notify(s, "pipeDrained");
+	}
+	if (!s->progress_pending && s->consumed - s->reported >= progressStep)
+	{
+		s->progress_pending = true;
+		notify(s, "progressChanged");
+	}
+	return true;
+}
+
+/// the unpacker's input: decompress straight into its buffer
+int64_t pipeRead(void *context, void *buf, int64_t maxlen)
+{
+	auto s = (PackPipeState *)context;
+	s->buf.out = (uint8_t *)buf;
+	s->buf.out_pos = 0;
+	s->buf.out_size = maxlen;
+	while (!s->buf.out_pos)
+	{
+		if (s->xz_done)
+			return 0;
+		if (s->buf.in_pos == s->buf.in_size && !takeInput(s))
+			return 0;
+		switch (xz_dec_run(s->xz, &s->buf))
+		{
+		case XZ_OK:
+		// the data can't be checked, which is no reason to throw it away
+		case XZ_UNSUPPORTED_CHECK:
+			break;
+		case XZ_STREAM_END:
+			s->xz_done = true;
+			break;
+		case XZ_MEM_ERROR:
+			setError(s, ForgePackPipeline::tr("Memory allocation failed"));
+			return 0;
+		case XZ_MEMLIMIT_ERROR:
+			setError(s, ForgePackPipeline::tr("Memory usage limit reached"));
+			return 0;
+		case XZ_FORMAT_ERROR:
+			setError(s, ForgePackPipeline::tr("Not a .xz file"));
+			return 0;
+		case XZ_OPTIONS_ERROR:
+			setError(s, ForgePackPipeline::tr("Unsupported options in the .xz headers"));
+			return 0;
+		case XZ_DATA_ERROR:
+		case XZ_BUF_ERROR:
+			setError(s, ForgePackPipeline::tr("File is corrupt"));
+			return 0;
+		default:
+			setError(s, ForgePackPipeline::tr("Unexpected result from the xz decoder"));
+			return 0;
+		}
+	}
+	return s->buf.out_pos;
+}
+
+/// the unpacker's output
+bool jarWrite(void *context, const void *buf, int64_t len)
+{
+	auto s = (PackPipeState *)context;
+	{
+		QMutexLocker locker(&s->mutex);
+		if (s->stop)
+			return false;
+	}
+	if (s->output.write((const char *)buf, len) != len)
+		return false;
+	s->hash.addData((const char *)buf, len);
+	return true;
+}
+
+void runWorker(PackPipeState *s)
+{
+	{
+		QMutexLocker locker(&s->mutex);
+		// the pipeline went away before a worker was free, it cleaned up already
+		if (s->stop)
+			return;
+		s->started = true;
+	}
+
+	QString error;
+	s->xz = xz_dec_init(XZ_DYNALLOC, 1 << 26);
+	if (!s->xz)
+	{
+		error = ForgePackPipeline::tr("Memory allocation failed");
+	}
+	else
+	{
+		s->buf.in = nullptr;
+		s->buf.in_pos = 0;
+		s->buf.in_size = 0;
+		try
+		{
+			unpack_200_stream(pipeRead, jarWrite, s);
+		}
+		catch (std::runtime_error &err)
+		{
+			error = QString::fromLocal8Bit(err.what());
+		}
+		xz_dec_end(s->xz);
+		s->xz = nullptr;
+	}
+	if (error.isEmpty() && !s->output.flush())
+		error = ForgePackPipeline::tr("Can't write %1: %2")
+					.arg(s->output.fileName(), s->output.errorString());
+	s->output.close();
+
+	QMutexLocker locker(&s->mutex);
+	// a reason from the decompressor explains the unpacker's problem better
+	if (s->error.isEmpty())
+		s->error = error;
+	// the old jar stays until there is a whole new one. done here, before anyone hears
+	// about it, so the next attempt's output can't be the one that gets removed
+	if (s->error.isEmpty() && !replaceFile(s->output.fileName(), s->target_path))
+		s->error = ForgePackPipeline::tr("Can't replace %1").arg(s->target_path);
+	if (!s->error.isEmpty())
+		s->output.remove();
+	s->succeeded = s->error.isEmpty();
+	if (s->succeeded)
+		s->md5 = s->hash.result().toHex();
+	s->done = true;
+	s->changed.wakeAll();
+	notify(s, "unpackFinished");
+}
+}
+
+class PackUnpackTask : public QRunnable
+{
+public:
+	PackUnpackTask(std::shared_ptr<PackPipeState> state) : m_state(state)
+	{
+	}
+	virtual void run()
+	{
+		runWorker(m_state.get());
+	}
+
+private:
+	std::shared_ptr<PackPipeState> m_state;
+};
+
+ForgePackPipeline::ForgePackPipeline(QString target_path, QObject *parent)
+	: QObject(parent), m_target_path(target_path), m_state(std::make_shared<PackPipeState>())
+{
+	m_state->receiver = this;
+}
+
+ForgePackPipeline::~ForgePackPipeline()
+{
+	auto s = m_state.get();
+	QMutexLocker locker(&s->mutex);
+	s->receiver = nullptr;
+	s->stop = true;
+	s->changed.wakeAll();
+	// a worker that is running stops at its next read or write
+	while (s->started && !s->done)
+		s->changed.wait(&s->mutex);
+	// one that didn't start yet never will, its output is ours to remove. a worker that ran
+	// removed it already if it failed
+	if (m_begun && !s->started)
+	{
+		s->output.close();
+		s->output.remove();
+	}
+}
+
+bool ForgePackPipeline::begin()
+{
+	// the tables are shared by all the decoders, set them up before any worker runs
+	static bool crcReady = false;
+	if (!crcReady)
+	{
+		xz_crc32_init();
+		xz_crc64_init();
+		crcReady = true;
+	}
+
+	m_state->target_path = m_target_path;
+	m_state->output.setFileName(m_target_path + ".part");
+	if (!m_state->output.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		m_state->error = tr("Can't open %1 for writing").arg(m_state->output.fileName());
+		return false;
+	}
+	m_begun = true;
+	return true;
+}
+
+void ForgePackPipeline::queueWorker()
+{
+	if (m_queued)
+		return;
+	m_queued = true;
+	unpackPool()->start(new PackUnpackTask(m_state));
+}
+
+bool ForgePackPipeline::readFrom(QIODevice *device)
+{
+	if (!m_begun || m_input_done)
+		return false;
+	auto s = m_state.get();
+	while (true)
+	{
+		{
+			QMutexLocker locker(&s->mutex);
+			if (s->stop || (s->done && !s->succeeded))
+				return false;
+			// the pack ended before the data did. the rest is of no use
+			if (s->done)
+			{
+				device->readAll();
+				return true;
+			}
+			// bounded from the first byte. a pack waiting for a worker leaves the rest of its
+			// download in the device, which stops reading the network
+			if (s->buffered >= pipeSize)
+			{
+				s->starved = true;
+				return true;
+			}
+		}
+		QByteArray chunk = device->read(chunkSize);
+		if (chunk.isEmpty())
+			return true;
+		{
+			QMutexLocker locker(&s->mutex);
+			s->chunks.append(chunk);
+			s->buffered += chunk.size();
+			s->changed.wakeAll();
+		}
+		// there is something to unpack now, a worker won't sit idle waiting for it
+		queueWorker();
+	}
+}
+
+void ForgePackPipeline::finish()
+{
+	if (!m_begun || m_input_done)
+		return;
+	m_input_done = true;
+	{
+		QMutexLocker locker(&m_state->mutex);
+		m_state->closed = true;
+		m_state->changed.wakeAll();
+	}
+	// no data came at all. the worker still has to say what's wrong with that
+	queueWorker();
+}
+
+bool ForgePackPipeline::successful() const
+{
+	QMutexLocker locker(&m_state->mutex);
+	return m_state->succeeded;
+}
+
+QString ForgePackPipeline::errorString() const
+{
+	QMutexLocker locker(&m_state->mutex);
+	return m_state->error;
+}
+
+QString ForgePackPipeline::md5() const
+{
+	QMutexLocker locker(&m_state->mutex);
+	return m_state->md5;
+}
+
+void ForgePackPipeline::pipeDrained()
+{
+	if (!m_input_done)
+		emit bufferFreed();
+}
+
+void ForgePackPipeline::progressChanged()
+{
+	qint64 done;
+	{
+		QMutexLocker locker(&m_state->mutex);
+		m_state->progress_pending = false;
+		m_state->reported = m_state->consumed;
+		done = m_state->consumed;
+	}
+	emit progress(done);
+}
+
+void ForgePackPipeline::unpackFinished()
+{
+	if (!successful())
+	{
+		QLOG_ERROR() << "Unpacking" << m_target_path << "failed:" << errorString();
+	}
+	emit finished();
+}
@@ -0,0 +1,88 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <memory>
+
+struct PackPipeState;
+
+/**
+ * Turns a .pack.xz into a jar while it downloads.
+ *
+ * The downloaded data goes through a pipe to a worker thread, which decompresses it and
+ * unpacks the pack200 data. The jar is written next to the target (as .part) and hashed on
+ * the way. It only replaces the target once it is complete, a failure leaves the old one alone.
+ * Nothing is stored in between, and the thread the pipeline lives in only copies memory.
+ *
+ * The workers come from a pool with one thread per core, so several libraries are unpacked
+ * at once while the rest are still downloading. A pipeline only asks for a worker once it has
+ * data, and a worker that runs out of data lets another one have its core until more comes.
+ * The pipe is bounded from the start: when it is full, the pipeline stops taking data and the
+ * rest stays in the device until bufferFreed() is emitted, like with DownloadSink.
+ *
+ * All methods are meant to be called from the thread the pipeline lives in.
+ */
+class ForgePackPipeline : public QObject
+{
+	Q_OBJECT
+public:
+	explicit ForgePackPipeline(QString target_path, QObject *parent = 0);
+	/// stops the worker. An unfinished jar is removed, the target is left alone.
+	virtual ~ForgePackPipeline();
+
+	/// open the target. false if it can't be written
+	bool begin();
+
+	/// take as much of the data waiting in the device as there is room for. false on errors
+	bool readFrom(QIODevice *device);
+
+	/// everything was handed over. finished() follows when the jar is complete, or broken
+	void finish();
+
+	/// did the worker produce a whole jar?
+	bool successful() const;
+	QString errorString() const;
+	/// MD5 of the jar, in hex
+	QString md5() const;
+
+signals:
+	/// the worker made room for more data
+	void bufferFreed();
+	/// how much of the data the worker got through
+	void progress(qint64 done);
+	/// the worker is done, see successful()
+	void finished();
+
+private
+slots:
+	/// these are queued from the worker thread
+	void pipeDrained();
+	void progressChanged();
+	void unpackFinished();
+
+private:
+	/// hand the pipeline to the pool, if it wasn't already
+	void queueWorker();
+
+private:
+	QString m_target_path;
+	/// shared with the worker, which may outlive the pipeline
+	std::shared_ptr<PackPipeState> m_state;
+	bool m_begun = false;
+	bool m_queued = false;
+	bool m_input_done = false;
+};
@@ -18,6 +18,7 @@
 #include "logic/net/NetJob.h"
 #include "logic/net/URLConstants.h"
 #include "MultiMC.h"
+#include "logic/MMCJson.h"
 
 #include <QtNetwork>
 #include <QtXml>
@@ -160,10 +161,21 @@ ForgeListLoadTask::ForgeListLoadTask(ForgeVersionList *vlist) : Task()
 void ForgeListLoadTask::executeTask()
 {
 	setStatus(tr("Fetching Forge version lists..."));
+	QList<MetaEntryRequest> requests;
+	requests.append({"minecraftforge", "list.json", QString()});
+	requests.append({"minecraftforge", "json", QString()});
+	connect(&m_entriesWatcher, SIGNAL(finished()), SLOT(entriesResolved()),
+			Qt::UniqueConnection);
+	m_entriesWatcher.setFuture(MMC->metacache()->resolveEntriesAsync(requests));
+}
+
+void ForgeListLoadTask::entriesResolved()
+{
 	auto job = new NetJob("Version index");
+	job->setPriority(Priority_Background);
 	// we do not care if the version is stale or not.
-	auto forgeListEntry = MMC->metacache()->resolveEntry("minecraftforge", "list.json");
-	auto gradleForgeListEntry = MMC->metacache()->resolveEntry("minecraftforge", "json");
+	auto forgeListEntry = m_entriesWatcher.future().resultAt(0);
+	auto gradleForgeListEntry = m_entriesWatcher.future().resultAt(1);
 
 	// verify by poking the server.
 	forgeListEntry->stale = true;
@@ -185,25 +197,15 @@ void ForgeListLoadTask::executeTask()
 
 bool ForgeListLoadTask::parseForgeList(QList<BaseVersionPtr> &out)
 {
-	QByteArray data;
+	QJsonDocument jsonDoc;
+	try
 	{
-		auto dlJob = listDownload;
-		auto filename = std::dynamic_pointer_cast<CacheDownload>(dlJob)->getTargetFilepath();
-		QFile listFile(filename);
-		if (!listFile.open(QIODevice::ReadOnly))
-		{
-			return false;
-		}
-		data = listFile.readAll();
-		dlJob.reset();
+		auto filename = std::dynamic_pointer_cast<CacheDownload>(listDownload)->getTargetFilepath();
+		jsonDoc = MMCJson::parseFile(filename, "The Forge version list");
 	}
-
-	QJsonParseError jsonError;
-	QJsonDocument jsonDoc = QJsonDocument::fromJson(data, &jsonError);
-
-	if (jsonError.error != QJsonParseError::NoError)
+	catch (MMCError &e)
 	{
-		emitFailed("Error parsing version list JSON:" + jsonError.errorString());
+		emitFailed("Error parsing version list JSON: " + e.cause());
 		return false;
 	}
 
@@ -296,25 +298,15 @@ bool ForgeListLoadTask::parseForgeList(QList<BaseVersionPtr> &out)
 
 bool ForgeListLoadTask::parseForgeGradleList(QList<BaseVersionPtr> &out)
 {
-	QByteArray data;
+	QJsonDocument jsonDoc;
+	try
 	{
-		auto dlJob = gradleListDownload;
-		auto filename = std::dynamic_pointer_cast<CacheDownload>(dlJob)->getTargetFilepath();
-		QFile listFile(filename);
-		if (!listFile.open(QIODevice::ReadOnly))
-		{
-			return false;
-		}
-		data = listFile.readAll();
-		dlJob.reset();
+		auto filename = std::dynamic_pointer_cast<CacheDownload>(gradleListDownload)->getTargetFilepath();
+		jsonDoc = MMCJson::parseFile(filename, "The Forge gradle version list");
 	}
-
-	QJsonParseError jsonError;
-	QJsonDocument jsonDoc = QJsonDocument::fromJson(data, &jsonError);
-
-	if (jsonError.error != QJsonParseError::NoError)
+	catch (MMCError &e)
 	{
-		emitFailed("Error parsing gradle version list JSON:" + jsonError.errorString());
+		emitFailed("Error parsing gradle version list JSON: " + e.cause());
 		return false;
 	}
 
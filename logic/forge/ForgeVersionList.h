@@ -19,10 +19,12 @@
 #include <QAbstractListModel>
 #include <QUrl>
 #include <QNetworkReply>
+#include <QFutureWatcher>
 
 #include "logic/BaseVersionList.h"
 #include "logic/tasks/Task.h"
 #include "logic/net/NetJob.h"
+#include "logic/net/HttpMetaCache.h"
 #include "logic/forge/ForgeVersion.h"
 
 class ForgeVersionList : public BaseVersionList
@@ -68,6 +70,7 @@ public:
 
 protected
 slots:
+	void entriesResolved();
 	void listDownloaded();
 	void listFailed();
 	void gradleListFailed();
@@ -79,6 +82,8 @@ protected:
 	CacheDownloadPtr listDownload;
 	CacheDownloadPtr gradleListDownload;
 
+	QFutureWatcher<MetaEntryPtr> m_entriesWatcher;
+
 private:
 	bool parseForgeList(QList<BaseVersionPtr> &out);
 	bool parseForgeGradleList(QList<BaseVersionPtr> &out);
@@ -15,21 +15,35 @@
 
 #include "MultiMC.h"
 #include "ForgeXzDownload.h"
+#include "logic/net/DownloadCoordinator.h"
+#include "logic/net/HostScheduler.h"
+#include "logic/net/BandwidthBudget.h"
 #include <pathutils.h>
 
-#include <QCryptographicHash>
 #include <QFileInfo>
 #include <QDateTime>
 #include <QDir>
 #include "logger/QsLog.h"
 
+// how long the first request may go without data before another mirror is asked too
+static const int hedgeDelay = 5000;
+
 ForgeXzDownload::ForgeXzDownload(QString relative_path, MetaEntryPtr entry) : NetAction()
 {
 	m_entry = entry;
 	m_target_path = entry->getFullPath();
-	m_pack200_xz_file.setFileTemplate("./dl_temp.XXXXXX");
+	m_hedge_file.setFileTemplate("./dl_temp.XXXXXX");
 	m_status = Job_NotStarted;
 	m_url_path = relative_path;
+	m_stall_timer.setSingleShot(true);
+	m_stall_timer.setInterval(hedgeDelay);
+	connect(&m_stall_timer, SIGNAL(timeout()), SLOT(hedgeStart()));
+}
+
+ForgeXzDownload::~ForgeXzDownload()
+{
+	// the hedged request has a host slot of its own
+	cancelHedge();
 }
 
 void ForgeXzDownload::setMirrors(QList<ForgeMirror> &mirrors)
@@ -61,6 +75,13 @@ void ForgeXzDownload::start()
 		emit failed(m_index_within_job);
 		return;
 	}
+	// if another job is already downloading this library, wait for it instead
+	if (!MMC->downloadCoordinator()->claim(getSharedPtr(), m_target_path))
+	{
+		return;
+	}
+	// whatever an earlier attempt started is of no use
+	m_pipeline.reset();
 
 	QLOG_INFO() << "Downloading " << m_url.toString();
 	QNetworkRequest request(m_url);
@@ -73,17 +94,275 @@ void ForgeXzDownload::start()
 	m_reply = std::shared_ptr<QNetworkReply>(rep);
 	connect(rep, SIGNAL(downloadProgress(qint64, qint64)),
 			SLOT(downloadProgress(qint64, qint64)));
-	connect(rep, SIGNAL(finished()), SLOT(downloadFinished()));
 	connect(rep, SIGNAL(error(QNetworkReply::NetworkError)),
 			SLOT(downloadError(QNetworkReply::NetworkError)));
-	connect(rep, SIGNAL(readyRead()), SLOT(downloadReadyRead()));
+	meterReply(rep);
+	m_stall_timer.start();
+}
+
+void ForgeXzDownload::hedgeStart()
+{
+	if (!m_reply || m_hedge_reply || m_mirrors.size() < 2)
+		return;
+	// data waiting for the bandwidth budget isn't a stall
+	if (m_reply->bytesAvailable())
+	{
+		m_stall_timer.start();
+		return;
+	}
+	// ask the next mirror that isn't paused and has a free slot, like any other request
+	auto scheduler = MMC->hostScheduler();
+	for (int i = 1; i < m_mirrors.size(); i++)
+	{
+		int candidate = (m_mirror_index + i) % m_mirrors.size();
+		QString host = QUrl(m_mirrors[candidate].mirror_url).host();
+		if (!scheduler->isTripped(host) && scheduler->tryAcquire(host, &m_hedge_generation))
+		{
+			m_hedge_mirror = candidate;
+			m_hedge_host = host;
+			break;
+		}
+	}
+	if (m_hedge_mirror < 0)
+		return;
+	if (!m_hedge_file.open())
+	{
+		scheduler->cancel(m_hedge_host);
+		m_hedge_host.clear();
+		m_hedge_mirror = -1;
+		return;
+	}
+	m_hedge_file.resize(0);
+	m_hedge_finish_pending = false;
+
+	QUrl url(m_mirrors[m_hedge_mirror].mirror_url + m_url_path + ".pack.xz");
+	QLOG_INFO() << m_url.toString() << "is stalling, also trying" << url.toString();
+	QNetworkRequest request(url);
+	request.setRawHeader(QString("If-None-Match").toLatin1(), m_entry->etag.toLatin1());
+	request.setHeader(QNetworkRequest::UserAgentHeader, "MultiMC/5.0 (Cached)");
+	QNetworkReply *rep = MMC->qnam()->get(request);
+	m_hedge_reply = std::shared_ptr<QNetworkReply>(rep);
+	// the data goes through the bandwidth budget, Qt only buffers a little of it
+	rep->setReadBufferSize(m_reply->readBufferSize());
+	connect(rep, SIGNAL(readyRead()), SLOT(hedgeReadyRead()));
+	connect(rep, SIGNAL(finished()), SLOT(hedgeFinished()));
+}
+
+bool ForgeXzDownload::readHedge()
+{
+	if (!m_hedge_reply || !m_hedge_reply->bytesAvailable())
+		return true;
+	auto budget = MMC->bandwidthBudget();
+	if (!budget->mayRead(m_priority))
+	{
+		connect(budget.get(), SIGNAL(budgetAvailable()), this, SLOT(hedgeBudgetAvailable()),
+				Qt::UniqueConnection);
+		return false;
+	}
+	QByteArray data = m_hedge_reply->readAll();
+	budget->consume(m_priority, data.size());
+	MMC->hostScheduler()->reportBytes(m_hedge_host, data.size());
+	if (m_hedge_file.write(data) < 0)
+	{
+		QLOG_ERROR() << "Failed writing into " + m_hedge_file.fileName();
+		hedgeFailed();
+	}
+	return true;
+}
+
+void ForgeXzDownload::hedgeReadyRead()
+{
+	if (m_hedge_finish_pending)
+		return;
+	readHedge();
+}
+
+void ForgeXzDownload::hedgeBudgetAvailable()
+{
+	if (!readHedge())
+		return;
+	disconnect(MMC->bandwidthBudget().get(), SIGNAL(budgetAvailable()), this,
+			   SLOT(hedgeBudgetAvailable()));
+	if (m_hedge_finish_pending)
+	{
+		m_hedge_finish_pending = false;
+		hedgeFinished();
+	}
+}
+
+void ForgeXzDownload::cancelHedge()
+{
+	if (!m_hedge_reply)
+		return;
+	disconnect(m_hedge_reply.get(), 0, this, 0);
+	m_hedge_reply->abort();
+	m_hedge_reply.reset();
+	m_hedge_file.close();
+	m_hedge_mirror = -1;
+	m_hedge_finish_pending = false;
+	// it was cut short, that says nothing about the host
+	auto scheduler = MMC->hostScheduler();
+	if (!m_hedge_host.isEmpty() && scheduler)
+		scheduler->cancel(m_hedge_host);
+	m_hedge_host.clear();
+}
+
+void ForgeXzDownload::hedgeFailed()
+{
+	if (!m_hedge_host.isEmpty())
+	{
+		MMC->hostScheduler()->release(m_hedge_host, false, m_hedge_generation);
+		m_hedge_host.clear();
+	}
+	cancelHedge();
+	// the first request died already, this was the last hope
+	if (!m_reply)
+	{
+		m_status = Job_Failed;
+		failAndTryNextMirror();
+	}
+}
+
+void ForgeXzDownload::hedgeFinished()
+{
+	if (!m_hedge_reply)
+		return;
+	// the last of the data has to go through the budget too
+	if (!readHedge())
+	{
+		m_hedge_finish_pending = true;
+		return;
+	}
+	if (!m_hedge_reply)
+		return;
+	int status =
+		m_hedge_reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+	if (m_hedge_reply->error() != QNetworkReply::NoError || (status != 200 && status != 304))
+	{
+		QLOG_WARN() << "Hedged request to" << m_hedge_reply->url().toString() << "failed.";
+		hedgeFailed();
+		return;
+	}
+	QLOG_INFO() << "Hedged request to" << m_hedge_reply->url().toString() << "won.";
+	MMC->hostScheduler()->release(m_hedge_host, true, m_hedge_generation);
+	m_hedge_host.clear();
+
+	// the other request lost, stop it
+	m_stall_timer.stop();
+	if (m_reply)
+	{
+		disconnect(m_reply.get(), 0, this, 0);
+		m_reply->abort();
+		m_reply.reset();
+	}
+
+	// remember the mirror that worked
+	m_mirror_index = m_hedge_mirror;
+	updateUrl();
+	m_etag = m_hedge_reply->rawHeader("ETag");
+	disconnect(m_hedge_reply.get(), 0, this, 0);
+	m_hedge_reply.reset();
+	m_hedge_mirror = -1;
+
+	if (status == 304)
+	{
+		m_hedge_file.close();
+		finishNotModified();
+		return;
+	}
+
+	// the jar is made from the file now, what the first request started is thrown away
+	if (!startPipeline())
+	{
+		m_hedge_file.close();
+		failAndTryNextMirror();
+		return;
+	}
+	connect(m_pipeline.get(), SIGNAL(bufferFreed()), SLOT(feedHedge()));
+	m_total_progress = m_received = m_hedge_file.size();
+	m_hedge_file.seek(0);
+	feedHedge();
+}
+
+void ForgeXzDownload::finishNotModified()
+{
+	// only good if the file is still there
+	if (!QFile::exists(m_target_path))
+	{
+		QLOG_ERROR() << m_url.toString() << "wasn't modified, but" << m_target_path
+					 << "is missing.";
+		m_pipeline.reset();
+		failAndTryNextMirror();
+		return;
+	}
+	m_pipeline.reset();
+	QFileInfo output_file_info(m_target_path);
+	m_entry->local_changed_timestamp =
+		output_file_info.lastModified().toUTC().toMSecsSinceEpoch();
+	m_entry->stale = false;
+	MMC->metacache()->updateEntry(m_entry);
+
+	m_received = m_unpacked = m_total_progress;
+	reportProgress();
+	m_status = Job_Finished;
+	m_reply.reset();
+	emit succeeded(m_index_within_job);
+}
+
+void ForgeXzDownload::feedHedge()
+{
+	if (!m_pipeline->readFrom(&m_hedge_file))
+	{
+		dropPipeline();
+		m_hedge_file.close();
+		failAndTryNextMirror();
+		return;
+	}
+	if (m_hedge_file.atEnd())
+		m_pipeline->finish();
+}
+
+void ForgeXzDownload::dropPipeline()
+{
+	if (!m_pipeline)
+		return;
+	// this may run in a slot called by the pipeline, it can't be deleted right away
+	disconnect(m_pipeline.get(), 0, this, 0);
+	m_pipeline.release()->deleteLater();
+}
+
+bool ForgeXzDownload::startPipeline()
+{
+	m_pipeline.reset(new ForgePackPipeline(m_target_path));
+	m_unpacked = 0;
+	connect(m_pipeline.get(), SIGNAL(finished()), SLOT(pipelineFinished()));
+	connect(m_pipeline.get(), SIGNAL(progress(qint64)), SLOT(unpackProgress(qint64)));
+	if (!m_pipeline->begin())
+	{
+		QLOG_ERROR() << m_pipeline->errorString();
+		m_pipeline.reset();
+		return false;
+	}
+	return true;
 }
 
 void ForgeXzDownload::downloadProgress(qint64 bytesReceived, qint64 bytesTotal)
 {
 	m_total_progress = bytesTotal;
-	m_progress = bytesReceived;
-	emit progress(m_index_within_job, bytesReceived, bytesTotal);
+	m_received = bytesReceived;
+	reportProgress();
+}
+
+void ForgeXzDownload::unpackProgress(qint64 done)
+{
+	m_unpacked = done;
+	reportProgress();
+}
+
+void ForgeXzDownload::reportProgress()
+{
+	m_progress = (m_received + m_unpacked) / 2;
+	emit progress(m_index_within_job, m_progress, m_total_progress);
 }
 
 void ForgeXzDownload::downloadError(QNetworkReply::NetworkError error)
@@ -106,6 +385,23 @@ void ForgeXzDownload::failAndTryNextMirror()
 	emit failed(m_index_within_job);
 }
 
+bool ForgeXzDownload::switchSource()
+{
+	// pick the next mirror that isn't paused
+	auto scheduler = MMC->hostScheduler();
+	for (int i = 1; i < m_mirrors.size(); i++)
+	{
+		int candidate = (m_mirror_index + i) % m_mirrors.size();
+		if (!scheduler->isTripped(QUrl(m_mirrors[candidate].mirror_url).host()))
+		{
+			m_mirror_index = candidate;
+			updateUrl();
+			return true;
+		}
+	}
+	return false;
+}
+
 void ForgeXzDownload::updateUrl()
 {
 	QLOG_INFO() << "Updating URL for " << m_url_path;
@@ -126,30 +422,39 @@ void ForgeXzDownload::downloadFinished()
 	{
 		QLOG_INFO() <<"dl " << index_within_job << " AUTOFAIL";
 		m_status = Job_Failed;
-		m_pack200_xz_file.close();
-		m_pack200_xz_file.remove();
 		m_reply.reset();
 		failAndTryNextMirror();
 		return;
 	}
 	*/
 
+	// the hedged request won and this one was dropped already
+	if (!m_reply)
+		return;
+
+	m_stall_timer.stop();
 	// if the download succeeded
 	if (m_status != Job_Failed)
 	{
 		// nothing went wrong...
-		m_status = Job_Finished;
-		if (m_pack200_xz_file.isOpen())
+		cancelHedge();
+		if (httpStatus() == 304)
+		{
+			// the jar we have is current
+			finishNotModified();
+			return;
+		}
+		if (m_pipeline)
 		{
-			// we actually downloaded something! process and isntall it
-			decompressAndInstall();
+			// we actually downloaded something! the pipeline finishes the jar
+			m_etag = m_reply->rawHeader("ETag");
+			m_pipeline->finish();
 			return;
 		}
 		else
 		{
 			// something bad happened -- on the local machine!
 			m_status = Job_Failed;
-			m_pack200_xz_file.remove();
 			m_reply.reset();
 			emit failed(m_index_within_job);
 			return;
@@ -158,10 +463,16 @@ void ForgeXzDownload::downloadFinished()
 	// else the download failed
 	else
 	{
-		m_status = Job_Failed;
-		m_pack200_xz_file.close();
-		m_pack200_xz_file.remove();
+		m_pipeline.reset();
 		m_reply.reset();
+		// the hedged request may still make it
+		if (m_hedge_reply)
+		{
+			QLOG_INFO() << m_url.toString() << "failed, waiting for the hedged request.";
+			m_status = Job_InProgress;
+			return;
+		}
+		m_status = Job_Failed;
 		failAndTryNextMirror();
 		return;
 	}
@@ -169,221 +480,87 @@ void ForgeXzDownload::downloadFinished()
 
 void ForgeXzDownload::downloadReadyRead()
 {
+	// still getting data, no need to ask another mirror
+	if (!m_hedge_reply)
+		m_stall_timer.start();
+
+	// only a real response is unpacked. error pages and redirects aren't jars
+	int status = httpStatus();
+	if (status < 200 || status >= 300)
+	{
+		m_reply->readAll();
+		if (status != 304)
+			m_status = Job_Failed;
+		return;
+	}
 
-	if (!m_pack200_xz_file.isOpen())
+	if (!m_pipeline)
 	{
-		if (!m_pack200_xz_file.open())
+		if (!startPipeline())
 		{
 			/*
-			* Can't open the file... the job failed
+			* Can't write the jar... the job failed
 			*/
+			m_status = Job_Failed;
 			m_reply->abort();
-			emit failed(m_index_within_job);
 			return;
 		}
+		connect(m_pipeline.get(), SIGNAL(bufferFreed()), SLOT(readMore()));
+	}
+	if (!m_pipeline->readFrom(m_reply.get()))
+	{
+		m_status = Job_Failed;
+		m_reply->abort();
 	}
-	m_pack200_xz_file.write(m_reply->readAll());
 }
 
-#include "xz.h"
-#include "unpack200.h"
-#include <stdexcept>
-
-const size_t buffer_size = 8196;
-
-void ForgeXzDownload::decompressAndInstall()
+void ForgeXzDownload::pipelineFinished()
 {
-	// rewind the downloaded temp file
-	m_pack200_xz_file.seek(0);
-	// de-xz'd file
-	QTemporaryFile pack200_file("./dl_temp.XXXXXX");
-	pack200_file.open();
-
-	bool xz_success = false;
-	// first, de-xz
+	if (!m_pipeline->successful())
 	{
-		uint8_t in[buffer_size];
-		uint8_t out[buffer_size];
-		struct xz_buf b;
-		struct xz_dec *s;
-		enum xz_ret ret;
-		xz_crc32_init();
-		xz_crc64_init();
-		s = xz_dec_init(XZ_DYNALLOC, 1 << 26);
-		if (s == nullptr)
-		{
-			xz_dec_end(s);
-			failAndTryNextMirror();
-			return;
-		}
-		b.in = in;
-		b.in_pos = 0;
-		b.in_size = 0;
-		b.out = out;
-		b.out_pos = 0;
-		b.out_size = buffer_size;
-		while (!xz_success)
+		QLOG_ERROR() << "Error unpacking" << m_url.toString() << ":" << m_pipeline->errorString();
+		// the download may still be running if the data went bad in the middle
+		m_stall_timer.stop();
+		cancelHedge();
+		m_hedge_file.close();
+		if (m_reply)
 		{
-			if (b.in_pos == b.in_size)
-			{
-				b.in_size = m_pack200_xz_file.read((char *)in, sizeof(in));
-				b.in_pos = 0;
-			}
-
-			ret = xz_dec_run(s, &b);
-
-			if (b.out_pos == sizeof(out))
-			{
-				if (pack200_file.write((char *)out, b.out_pos) != b.out_pos)
-				{
-					// msg = "Write error\n";
-					xz_dec_end(s);
-					failAndTryNextMirror();
-					return;
-				}
-
-				b.out_pos = 0;
-			}
-
-			if (ret == XZ_OK)
-				continue;
-
-			if (ret == XZ_UNSUPPORTED_CHECK)
-			{
-				// unsupported check. this is OK, but we should log this
-				continue;
-			}
-
-			if (pack200_file.write((char *)out, b.out_pos) != b.out_pos)
-			{
-				// write error
-				pack200_file.close();
-				xz_dec_end(s);
-				return;
-			}
-
-			switch (ret)
-			{
-			case XZ_STREAM_END:
-				xz_dec_end(s);
-				xz_success = true;
-				break;
-
-			case XZ_MEM_ERROR:
-				QLOG_ERROR() << "Memory allocation failed\n";
-				xz_dec_end(s);
-				failAndTryNextMirror();
-				return;
-
-			case XZ_MEMLIMIT_ERROR:
-				QLOG_ERROR() << "Memory usage limit reached\n";
-				xz_dec_end(s);
-				failAndTryNextMirror();
-				return;
-
-			case XZ_FORMAT_ERROR:
-				QLOG_ERROR() << "Not a .xz file\n";
-				xz_dec_end(s);
-				failAndTryNextMirror();
-				return;
-
-			case XZ_OPTIONS_ERROR:
-				QLOG_ERROR() << "Unsupported options in the .xz headers\n";
-				xz_dec_end(s);
-				failAndTryNextMirror();
-				return;
-
-			case XZ_DATA_ERROR:
-			case XZ_BUF_ERROR:
-				QLOG_ERROR() << "File is corrupt\n";
-				xz_dec_end(s);
-				failAndTryNextMirror();
-				return;
-
-			default:
-				QLOG_ERROR() << "Bug!\n";
-				xz_dec_end(s);
-				failAndTryNextMirror();
-				return;
-			}
+			disconnect(m_reply.get(), 0, this, 0);
+			m_reply->abort();
+			m_reply.reset();
 		}
-	}
-	m_pack200_xz_file.remove();
-
-	// revert pack200
-	pack200_file.seek(0);
-	int handle_in = pack200_file.handle();
-	// FIXME: dispose of file handles, pointers and the like. Ideally wrap in objects.
-	if(handle_in == -1)
-	{
-		QLOG_ERROR() << "Error reopening " << pack200_file.fileName();
-		failAndTryNextMirror();
-		return;
-	}
-	FILE * file_in = fdopen(handle_in,"r");
-	if(!file_in)
-	{
-		QLOG_ERROR() << "Error reopening " << pack200_file.fileName();
-		failAndTryNextMirror();
-		return;
-	}
-	QFile qfile_out(m_target_path);
-	if(!qfile_out.open(QIODevice::WriteOnly))
-	{
-		QLOG_ERROR() << "Error opening " << qfile_out.fileName();
-		failAndTryNextMirror();
-		return;
-	}
-	int handle_out = qfile_out.handle();
-	if(handle_out == -1)
-	{
-		QLOG_ERROR() << "Error opening " << qfile_out.fileName();
+		// the next attempt needs a pipeline of its own
+		dropPipeline();
 		failAndTryNextMirror();
 		return;
 	}
-	FILE * file_out = fdopen(handle_out,"w");
-	if(!file_out)
-	{
-		QLOG_ERROR() << "Error opening " << qfile_out.fileName();
-		failAndTryNextMirror();
-		return;
-	}
-	try
-	{
-		unpack_200(file_in, file_out);
-	}
-	catch (std::runtime_error &err)
-	{
-		m_status = Job_Failed;
-		QLOG_ERROR() << "Error unpacking " << pack200_file.fileName() << " : " << err.what();
-		QFile f(m_target_path);
-		if (f.exists())
-			f.remove();
-		failAndTryNextMirror();
-		return;
-	}
-	pack200_file.remove();
-
-	QFile jar_file(m_target_path);
-
-	if (!jar_file.open(QIODevice::ReadOnly))
-	{
-		jar_file.remove();
-		failAndTryNextMirror();
-		return;
-	}
-	m_entry->md5sum = QCryptographicHash::hash(jar_file.readAll(), QCryptographicHash::Md5)
-						  .toHex()
-						  .constData();
-	jar_file.close();
+	m_hedge_file.close();
 
 	QFileInfo output_file_info(m_target_path);
-	m_entry->etag = m_reply->rawHeader("ETag").constData();
+	m_entry->md5sum = m_pipeline->md5();
+	m_entry->etag = m_etag.constData();
 	m_entry->local_changed_timestamp =
 		output_file_info.lastModified().toUTC().toMSecsSinceEpoch();
 	m_entry->stale = false;
 	MMC->metacache()->updateEntry(m_entry);
 
+	m_received = m_unpacked = m_total_progress;
+	reportProgress();
+	m_status = Job_Finished;
 	m_reply.reset();
 	emit succeeded(m_index_within_job);
 }
+
+void ForgeXzDownload::attachedSucceeded(NetAction *leader)
+{
+	// the other download has put the library in the cache, pick up its entry
+	auto entry = MMC->metacache()->resolveEntry(m_entry->base, m_entry->path);
+	if (entry->stale)
+	{
+		attachedFailed(leader);
+		return;
+	}
+	*m_entry = *entry;
+	m_status = Job_Finished;
+	emit succeeded(m_index_within_job);
+}
@@ -19,7 +19,10 @@
 #include "logic/net/HttpMetaCache.h"
 #include <QFile>
 #include <QTemporaryFile>
+#include <QTimer>
+#include <memory>
 #include "ForgeMirror.h"
+#include "ForgePackPipeline.h"
 
 typedef std::shared_ptr<class ForgeXzDownload> ForgeXzDownloadPtr;
 
@@ -30,8 +33,13 @@ public:
 	MetaEntryPtr m_entry;
 	/// if saving to file, use the one specified in this string
 	QString m_target_path;
-	/// this is the output file, if any
-	QTemporaryFile m_pack200_xz_file;
+	/// turns the downloaded data into the jar, as it arrives
+	std::unique_ptr<ForgePackPipeline> m_pipeline;
+	/// of the reply the jar was made from
+	QByteArray m_etag;
+	/// data downloaded, and how much of it was unpacked
+	qint64 m_received = 0;
+	qint64 m_unpacked = 0;
 	/// mirror index (NOT OPTICS, I SWEAR)
 	int m_mirror_index = 0;
 	/// list of mirrors to use. Mirror has the url base
@@ -39,14 +47,30 @@ public:
 	/// path relative to the mirror base
 	QString m_url_path;
 
+	/// second request to another mirror, started when the first one stalls
+	std::shared_ptr<QNetworkReply> m_hedge_reply;
+	/// output of the hedged request
+	QTemporaryFile m_hedge_file;
+	/// mirror of the hedged request
+	int m_hedge_mirror = -1;
+	/// host slot the hedged request holds, empty if none
+	QString m_hedge_host;
+	int m_hedge_generation = 0;
+	/// the hedged request finished, but still holds data the budget didn't allow yet
+	bool m_hedge_finish_pending = false;
+	/// fires when the first request didn't get any data for a while
+	QTimer m_stall_timer;
+
 public:
 	explicit ForgeXzDownload(QString relative_path, MetaEntryPtr entry);
 	static ForgeXzDownloadPtr make(QString relative_path, MetaEntryPtr entry)
 	{
 		return ForgeXzDownloadPtr(new ForgeXzDownload(relative_path, entry));
 	}
-	virtual ~ForgeXzDownload(){};
+	virtual ~ForgeXzDownload();
 	void setMirrors(QList<ForgeMirror> & mirrors);
+	virtual void attachedSucceeded(NetAction *leader);
+	virtual bool switchSource();
 
 protected
 slots:
@@ -54,13 +78,33 @@ slots:
 	virtual void downloadError(QNetworkReply::NetworkError error);
 	virtual void downloadFinished();
 	virtual void downloadReadyRead();
+	void hedgeStart();
+	void hedgeReadyRead();
+	void hedgeFinished();
+	void hedgeBudgetAvailable();
+	/// hand more of the hedged request's file to the pipeline
+	void feedHedge();
+	void pipelineFinished();
+	void unpackProgress(qint64 done);
 
 public
 slots:
 	virtual void start();
 
 private:
-	void decompressAndInstall();
+	/// start a new pipeline, throwing away whatever the last one did
+	bool startPipeline();
+	/// get rid of the pipeline, even from one of its own signals
+	void dropPipeline();
 	void failAndTryNextMirror();
 	void updateUrl();
+	void cancelHedge();
+	/// read what the hedged request has, if the budget allows it. false if some of it is left
+	bool readHedge();
+	/// the hedged request failed. if the first one is gone too, so is this attempt
+	void hedgeFailed();
+	/// the server says the file we have is current
+	void finishNotModified();
+	/// downloading and unpacking count half each
+	void reportProgress();
 };
@@ -16,6 +16,7 @@
 #include "LiteLoaderVersionList.h"
 #include "MultiMC.h"
 #include "logic/net/URLConstants.h"
+#include "logic/MMCJson.h"
 #include <MMCError.h>
 
 #include <QtXml>
@@ -103,6 +104,7 @@ void LLListLoadTask::executeTask()
 {
 	setStatus(tr("Loading LiteLoader version list..."));
 	auto job = new NetJob("Version index");
+	job->setPriority(Priority_Background);
 	// we do not care if the version is stale or not.
 	auto liteloaderEntry = MMC->metacache()->resolveEntry("liteloader", "versions.json");
 
@@ -128,27 +130,15 @@ void LLListLoadTask::listFailed()
 
 void LLListLoadTask::listDownloaded()
 {
-	QByteArray data;
+	QJsonDocument jsonDoc;
+	try
 	{
-		auto dlJob = listDownload;
-		auto filename = std::dynamic_pointer_cast<CacheDownload>(dlJob)->getTargetFilepath();
-		QFile listFile(filename);
-		if (!listFile.open(QIODevice::ReadOnly))
-		{
-			emitFailed("Failed to open the LiteLoader version list.");
-			return;
-		}
-		data = listFile.readAll();
-		listFile.close();
-		dlJob.reset();
+		auto filename = std::dynamic_pointer_cast<CacheDownload>(listDownload)->getTargetFilepath();
+		jsonDoc = MMCJson::parseFile(filename, "The LiteLoader version list");
 	}
-
-	QJsonParseError jsonError;
-	QJsonDocument jsonDoc = QJsonDocument::fromJson(data, &jsonError);
-
-	if (jsonError.error != QJsonParseError::NoError)
+	catch (MMCError &e)
 	{
-		emitFailed("Error parsing version list JSON:" + jsonError.errorString());
+		emitFailed("Error parsing version list JSON: " + e.cause());
 		return;
 	}
 
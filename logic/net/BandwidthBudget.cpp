@@ -0,0 +1,129 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "BandwidthBudget.h"
+#include "logic/settings/SettingsObject.h"
+#include "logic/settings/Setting.h"
+#include "logger/QsLog.h"
+
+// how often the buckets are refilled
+static const int refillInterval = 100;
+// the most a bucket can save up, in seconds of its rate
+static const double burstSeconds = 0.25;
+// smallest burst, so a low limit doesn't turn into tiny reads
+static const qint64 minBurst = 16 * 1024;
+// rate of background downloads while they are preempted
+static const qint64 trickleRate = 16 * 1024;
+
+BandwidthBudget::BandwidthBudget(QObject *parent) : QObject(parent)
+{
+	loadSettings();
+	connect(MMC->settings().get(), SIGNAL(SettingChanged(const Setting &, QVariant)),
+			SLOT(SettingChanged(const Setting &, QVariant)));
+	m_refillTimer.setInterval(refillInterval);
+	connect(&m_refillTimer, SIGNAL(timeout()), SLOT(refill()));
+}
+
+void BandwidthBudget::loadSettings()
+{
+	m_rate = qMax(0, MMC->settings()->get("NetRateLimit").toInt()) * 1024;
+	m_tokens = qMin(m_tokens, qMax(minBurst, qint64(m_rate * burstSeconds)));
+}
+
+void BandwidthBudget::SettingChanged(const Setting &setting, QVariant)
+{
+	if (setting.id() != "NetRateLimit")
+		return;
+	loadSettings();
+	QLOG_INFO() << "Download rate limit set to" << m_rate / 1024 << "KiB/s";
+	emit budgetAvailable();
+}
+
+bool BandwidthBudget::isPreempted(NetPriority priority) const
+{
+	return priority == Priority_Background && m_jobs[Priority_Critical] > 0;
+}
+
+bool BandwidthBudget::mayRead(NetPriority priority)
+{
+	bool allowed = true;
+	if (isPreempted(priority) && m_trickle_tokens <= 0)
+		allowed = false;
+	if (m_rate && m_tokens <= 0)
+		allowed = false;
+	if (!allowed)
+		waitForRefill();
+	return allowed;
+}
+
+void BandwidthBudget::consume(NetPriority priority, qint64 bytes)
+{
+	// reads aren't split, so this can go into debt. it's paid back by the next refills.
+	if (isPreempted(priority))
+		m_trickle_tokens -= bytes;
+	if (m_rate)
+		m_tokens -= bytes;
+}
+
+void BandwidthBudget::waitForRefill()
+{
+	m_refused = true;
+	if (!m_refillTimer.isActive())
+	{
+		m_refillClock.start();
+		m_refillTimer.start();
+	}
+}
+
+void BandwidthBudget::refill()
+{
+	qint64 elapsed = m_refillClock.restart();
+	if (m_rate)
+	{
+		qint64 burst = qMax(minBurst, qint64(m_rate * burstSeconds));
+		m_tokens = qMin(burst, m_tokens + m_rate * elapsed / 1000);
+	}
+	m_trickle_tokens = qMin(minBurst, m_trickle_tokens + trickleRate * elapsed / 1000);
+
+	if (!m_refused)
+	{
+		m_refillTimer.stop();
+		return;
+	}
+	m_refused = false;
+	emit budgetAvailable();
+}
+
+void BandwidthBudget::jobStarted(NetPriority priority)
+{
+	m_jobs[priority]++;
+	if (priority == Priority_Critical && m_jobs[priority] == 1)
+	{
+		QLOG_INFO() << "Launch-critical download started, holding back background downloads.";
+		emit preemptionChanged();
+	}
+}
+
+void BandwidthBudget::jobFinished(NetPriority priority)
+{
+	if (m_jobs[priority] > 0)
+		m_jobs[priority]--;
+	if (priority == Priority_Critical && m_jobs[priority] == 0)
+	{
+		emit preemptionChanged();
+		emit budgetAvailable();
+	}
+}
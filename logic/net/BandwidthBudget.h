@@ -0,0 +1,89 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QVariant>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include "NetAction.h"
+
+class Setting;
+
+/**
+ * Global byte-rate budget shared by all downloads.
+ *
+ * All traffic draws from one token bucket when a rate limit is configured. While a
+ * launch-critical job runs, background jobs are preempted: they don't start new parts
+ * and their running downloads are slowed to a trickle, so they don't time out.
+ *
+ * Downloads that are out of budget stop reading their reply. Qt then stops reading the
+ * socket once the reply's read buffer is full and TCP slows the sender down.
+ */
+class BandwidthBudget : public QObject
+{
+	Q_OBJECT
+public:
+	explicit BandwidthBudget(QObject *parent = 0);
+	virtual ~BandwidthBudget() {};
+
+	/// may a download of this priority read data now?
+	bool mayRead(NetPriority priority);
+	/// account bytes read by a download of this priority
+	void consume(NetPriority priority, qint64 bytes);
+	/// true if jobs of this priority shouldn't start new parts
+	bool isPreempted(NetPriority priority) const;
+
+	/// jobs report when they run, so the preemption can be decided
+	void jobStarted(NetPriority priority);
+	void jobFinished(NetPriority priority);
+
+	/// configured limit in bytes per second, 0 if unlimited
+	qint64 rateLimit() const
+	{
+		return m_rate;
+	}
+
+signals:
+	/// downloads that were refused can try reading again
+	void budgetAvailable();
+	/// the preemption of background jobs started or ended
+	void preemptionChanged();
+
+private
+slots:
+	void refill();
+	void SettingChanged(const Setting &setting, QVariant value);
+
+private:
+	void loadSettings();
+	void waitForRefill();
+
+private:
+	QTimer m_refillTimer;
+	QElapsedTimer m_refillClock;
+	/// bytes per second, 0 for unlimited
+	qint64 m_rate = 0;
+	/// available bytes of the shared bucket. negative when in debt
+	qint64 m_tokens = 0;
+	/// available bytes of preempted background downloads
+	qint64 m_trickle_tokens = 0;
+	/// running jobs, by priority
+	int m_jobs[Priority_Count] = {};
+	/// did anyone get refused since the last refill?
+	bool m_refused = false;
+};
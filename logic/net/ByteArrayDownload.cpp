@@ -26,6 +26,7 @@ ByteArrayDownload::ByteArrayDownload(QUrl url) : NetAction()
 void ByteArrayDownload::start()
 {
 	QLOG_INFO() << "Downloading " << m_url.toString();
+	m_data.clear();
 	QNetworkRequest request(m_url);
 	request.setHeader(QNetworkRequest::UserAgentHeader, "MultiMC/5.0 (Uncached)");
 	auto worker = MMC->qnam();
@@ -34,10 +35,9 @@ void ByteArrayDownload::start()
 	m_reply = std::shared_ptr<QNetworkReply>(rep);
 	connect(rep, SIGNAL(downloadProgress(qint64, qint64)),
 			SLOT(downloadProgress(qint64, qint64)));
-	connect(rep, SIGNAL(finished()), SLOT(downloadFinished()));
 	connect(rep, SIGNAL(error(QNetworkReply::NetworkError)),
 			SLOT(downloadError(QNetworkReply::NetworkError)));
-	connect(rep, SIGNAL(readyRead()), SLOT(downloadReadyRead()));
+	meterReply(rep);
 }
 
 void ByteArrayDownload::downloadProgress(qint64 bytesReceived, qint64 bytesTotal)
@@ -84,7 +84,7 @@ void ByteArrayDownload::downloadFinished()
 	{
 		// nothing went wrong...
 		m_status = Job_Finished;
-		m_data = m_reply->readAll();
+		m_data.append(m_reply->readAll());
 		m_content_type = m_reply->header(QNetworkRequest::ContentTypeHeader).toString();
 		m_reply.reset();
 		emit succeeded(m_index_within_job);
@@ -101,5 +101,6 @@ void ByteArrayDownload::downloadFinished()
 
 void ByteArrayDownload::downloadReadyRead()
 {
-	// ~_~
+	// read as it comes, the reply only buffers a little
+	m_data.append(m_reply->readAll());
 }
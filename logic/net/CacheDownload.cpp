@@ -15,20 +15,24 @@
 
 #include "MultiMC.h"
 #include "CacheDownload.h"
+#include "DownloadCoordinator.h"
 #include <pathutils.h>
 
 #include <QCryptographicHash>
 #include <QFileInfo>
 #include <QDateTime>
+#include <QSaveFile>
+#include "logic/GZip.h"
 #include "logger/QsLog.h"
 
 CacheDownload::CacheDownload(QUrl url, MetaEntryPtr entry)
-	: NetAction(), md5sum(QCryptographicHash::Md5)
+	: NetAction(), m_sink(QCryptographicHash::Md5)
 {
 	m_url = url;
 	m_entry = entry;
 	m_target_path = entry->getFullPath();
 	m_status = Job_NotStarted;
+	connect(&m_sink, SIGNAL(bufferFreed()), SLOT(readMore()));
 }
 
 void CacheDownload::start()
@@ -40,9 +44,11 @@ void CacheDownload::start()
 		emit succeeded(m_index_within_job);
 		return;
 	}
-	// create a new save file
-	m_output_file.reset(new QSaveFile(m_target_path));
-
+	// if another job is already downloading this file, wait for it instead
+	if (!MMC->downloadCoordinator()->claim(getSharedPtr(), m_target_path))
+	{
+		return;
+	}
 	// if there already is a file and md5 checking is in effect and it can be opened
 	if (!ensureFilePathExists(m_target_path))
 	{
@@ -51,25 +57,56 @@ void CacheDownload::start()
 		emit failed(m_index_within_job);
 		return;
 	}
-	if (!m_output_file->open(QIODevice::WriteOnly))
+
+	wroteAnyData = false;
+	m_checked_response = false;
+	m_resume_offset = 0;
+
+	// continue where the last attempt left off, if it left anything usable
+	m_output_file.setFileName(m_target_path + ".part");
+	QFileInfo partial_info(m_output_file.fileName());
+	bool resume = !m_resume_validator.isEmpty() && partial_info.isFile() && partial_info.size();
+	if (resume)
+	{
+		if (!m_output_file.open(QIODevice::ReadWrite))
+		{
+			QLOG_ERROR() << "Could not open " + m_output_file.fileName() + " for writing";
+			m_status = Job_Failed;
+			emit failed(m_index_within_job);
+			return;
+		}
+		m_resume_offset = m_output_file.size();
+	}
+	else if (!m_output_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
 	{
-		QLOG_ERROR() << "Could not open " + m_target_path + " for writing";
+		QLOG_ERROR() << "Could not open " + m_output_file.fileName() + " for writing";
 		m_status = Job_Failed;
 		emit failed(m_index_within_job);
 		return;
 	}
-	QLOG_INFO() << "Downloading " << m_url.toString();
+	// when resuming, the hash has to cover the whole file, not just the new part
+	m_sink.begin(&m_output_file, resume);
 	QNetworkRequest request(m_url);
 
-	// check file consistency first.
-	QFile current(m_target_path);
-	if(current.exists() && current.size() != 0)
+	if (resume)
 	{
-		if (m_entry->remote_changed_timestamp.size())
-			request.setRawHeader(QString("If-Modified-Since").toLatin1(),
-								m_entry->remote_changed_timestamp.toLatin1());
-		if (m_entry->etag.size())
-			request.setRawHeader(QString("If-None-Match").toLatin1(), m_entry->etag.toLatin1());
+		QLOG_INFO() << "Resuming " << m_url.toString() << " at " << m_resume_offset;
+		request.setRawHeader("Range", QString("bytes=%1-").arg(m_resume_offset).toLatin1());
+		request.setRawHeader("If-Range", m_resume_validator);
+	}
+	else
+	{
+		QLOG_INFO() << "Downloading " << m_url.toString();
+		// check file consistency first.
+		QFile current(m_target_path);
+		if(current.exists() && current.size() != 0)
+		{
+			if (m_entry->remote_changed_timestamp.size())
+				request.setRawHeader(QString("If-Modified-Since").toLatin1(),
+									m_entry->remote_changed_timestamp.toLatin1());
+			if (m_entry->etag.size())
+				request.setRawHeader(QString("If-None-Match").toLatin1(), m_entry->etag.toLatin1());
+		}
 	}
 
 	request.setHeader(QNetworkRequest::UserAgentHeader, "MultiMC/5.0 (Cached)");
@@ -80,14 +117,17 @@ void CacheDownload::start()
 	m_reply = std::shared_ptr<QNetworkReply>(rep);
 	connect(rep, SIGNAL(downloadProgress(qint64, qint64)),
 			SLOT(downloadProgress(qint64, qint64)));
-	connect(rep, SIGNAL(finished()), SLOT(downloadFinished()));
 	connect(rep, SIGNAL(error(QNetworkReply::NetworkError)),
 			SLOT(downloadError(QNetworkReply::NetworkError)));
-	connect(rep, SIGNAL(readyRead()), SLOT(downloadReadyRead()));
+	meterReply(rep);
 }
 
 void CacheDownload::downloadProgress(qint64 bytesReceived, qint64 bytesTotal)
 {
+	// when resuming, the reply only knows about the remaining part
+	if (bytesTotal >= 0)
+		bytesTotal += m_resume_offset;
+	bytesReceived += m_resume_offset;
 	m_total_progress = bytesTotal;
 	m_progress = bytesReceived;
 	emit progress(m_index_within_job, bytesReceived, bytesTotal);
@@ -118,32 +158,58 @@ void CacheDownload::downloadFinished()
 	{
 		m_url = QUrl(redirect.toString());
 		QLOG_INFO() << "Following redirect to " << m_url.toString();
+		m_sink.finish();
+		m_output_file.close();
 		start();
 		return;
 	}
 
+	// everything the writer has is in the file after this
+	if (!m_sink.finish())
+		m_status = Job_Failed;
+
 	// if the download succeeded
 	if (m_status == Job_Failed)
 	{
-		m_output_file->cancelWriting();
+		m_output_file.close();
+		keepOrDropPartial();
 		m_reply.reset();
 		emit failed(m_index_within_job);
 		return;
 	}
+	m_output_file.close();
 
-	// if we wrote any data to the save file, we try to commit the data to the real file.
+	// if we wrote any data to the partial file, we try to move it over the real file.
 	if (wroteAnyData)
 	{
+		QString md5 = m_sink.result().toHex().constData();
+		// resumed data is only as good as the server's word. check it if we can.
+		QString etag_md5 = md5FromEtag(m_reply->rawHeader("ETag"));
+		if (m_resume_offset && !etag_md5.isEmpty() && etag_md5 != md5)
+		{
+			QLOG_ERROR() << "Resumed download of " << m_url.toString()
+						 << " doesn't match its ETag, starting over.";
+			QFile::remove(m_output_file.fileName());
+			m_resume_validator.clear();
+			m_reply.reset();
+			m_status = Job_Failed;
+			emit failed(m_index_within_job);
+			return;
+		}
 		// nothing went wrong...
-		if (m_output_file->commit())
+		if (replaceFile(m_output_file.fileName(), m_target_path))
 		{
 			m_status = Job_Finished;
-			m_entry->md5sum = md5sum.result().toHex().constData();
+			// metadata may be kept compressed, the readers inflate it
+			if (MMC->metacache()->storesCompressed(m_entry))
+				compressTarget(md5);
+			m_entry->md5sum = md5;
 		}
 		else
 		{
 			QLOG_ERROR() << "Failed to commit changes to " << m_target_path;
-			m_output_file->cancelWriting();
+			QFile::remove(m_output_file.fileName());
+			m_resume_validator.clear();
 			m_reply.reset();
 			m_status = Job_Failed;
 			emit failed(m_index_within_job);
@@ -152,11 +218,10 @@ void CacheDownload::downloadFinished()
 	}
 	else
 	{
+		QFile::remove(m_output_file.fileName());
 		m_status = Job_Finished;
 	}
-
-	// then get rid of the save file
-	m_output_file.reset();
+	m_resume_validator.clear();
 
 	QFileInfo output_file_info(m_target_path);
 
@@ -175,11 +240,66 @@ void CacheDownload::downloadFinished()
 	return;
 }
 
+void CacheDownload::keepOrDropPartial()
+{
+	// keep what we got for the next attempt, if the server told us enough to resume it
+	QByteArray validator = resumeValidator();
+	if (wroteAnyData && !validator.isEmpty() && m_output_file.size())
+	{
+		m_resume_validator = validator;
+		QLOG_INFO() << "Keeping " << m_output_file.size() << " bytes of " << m_url.toString()
+					<< " for resuming.";
+		return;
+	}
+	m_resume_validator.clear();
+	QFile::remove(m_output_file.fileName());
+}
+
+bool CacheDownload::compressTarget(QString &md5)
+{
+	QFile plain(m_target_path);
+	if (!plain.open(QIODevice::ReadOnly))
+		return false;
+	QByteArray data = plain.readAll();
+	plain.close();
+
+	QByteArray compressed;
+	// the server may have sent it compressed already
+	if (GZip::isCompressed(data) || !GZip::zip(data, compressed))
+		return false;
+	QSaveFile output(m_target_path);
+	if (!output.open(QIODevice::WriteOnly) || output.write(compressed) != compressed.size() ||
+		!output.commit())
+	{
+		QLOG_WARN() << "Couldn't compress " << m_target_path << ", keeping it as it is.";
+		return false;
+	}
+	md5 = QCryptographicHash::hash(compressed, QCryptographicHash::Md5).toHex().constData();
+	return true;
+}
+
 void CacheDownload::downloadReadyRead()
 {
-	QByteArray ba = m_reply->readAll();
-	md5sum.addData(ba);
-	if (m_output_file->write(ba) != ba.size())
+	if (!m_checked_response)
+	{
+		m_checked_response = true;
+		if (m_resume_offset && httpStatus() != 206)
+		{
+			// the server can't do ranges or the file changed since. start from scratch.
+			QLOG_INFO() << "Server refused to resume " << m_url.toString()
+						<< ", downloading the whole file.";
+			m_sink.restart();
+			m_resume_offset = 0;
+		}
+	}
+	// don't write the bodies of redirects into the file
+	int status = httpStatus();
+	if (status >= 300 && status < 400)
+	{
+		m_reply->readAll();
+		return;
+	}
+	if (!m_sink.readFrom(m_reply.get()))
 	{
 		QLOG_ERROR() << "Failed writing into " + m_target_path;
 		m_status = Job_Failed;
@@ -188,3 +308,17 @@ void CacheDownload::downloadReadyRead()
 	}
 	wroteAnyData = true;
 }
+
+void CacheDownload::attachedSucceeded(NetAction *leader)
+{
+	// the other download has put the file in the cache, pick up its entry
+	auto entry = MMC->metacache()->resolveEntry(m_entry->base, m_entry->path);
+	if (entry->stale)
+	{
+		attachedFailed(leader);
+		return;
+	}
+	*m_entry = *entry;
+	m_status = Job_Finished;
+	emit succeeded(m_index_within_job);
+}
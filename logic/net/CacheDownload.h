@@ -17,8 +17,8 @@
 
 #include "NetAction.h"
 #include "HttpMetaCache.h"
-#include <QCryptographicHash>
-#include <QSaveFile>
+#include "DownloadSink.h"
+#include <QFile>
 
 typedef std::shared_ptr<class CacheDownload> CacheDownloadPtr;
 class CacheDownload : public NetAction
@@ -28,13 +28,20 @@ private:
 	MetaEntryPtr m_entry;
 	/// if saving to file, use the one specified in this string
 	QString m_target_path;
-	/// this is the output file, if any
-	std::shared_ptr<QSaveFile> m_output_file;
-	/// the hash-as-you-download
-	QCryptographicHash md5sum;
+	/// data is downloaded into this file and moved to the target path when complete
+	QFile m_output_file;
+	/// writes and hashes the data as it arrives
+	DownloadSink m_sink;
 
 	bool wroteAnyData = false;
 
+	/// ETag or Last-Modified of the response the partial data came from. empty if there's none.
+	QByteArray m_resume_validator;
+	/// how many bytes we already had when the current request was made
+	qint64 m_resume_offset = 0;
+	/// true once the status of the current response has been looked at
+	bool m_checked_response = false;
+
 public:
 	explicit CacheDownload(QUrl url, MetaEntryPtr entry);
 	static CacheDownloadPtr make(QUrl url, MetaEntryPtr entry)
@@ -46,6 +53,12 @@ public:
 	{
 		return m_target_path;
 	}
+	virtual void attachedSucceeded(NetAction *leader);
+
+private:
+	void keepOrDropPartial();
+	/// gzip the finished file in place, updating md5 to match. false if it stays as it is
+	bool compressTarget(QString &md5);
 protected
 slots:
 	virtual void downloadProgress(qint64 bytesReceived, qint64 bytesTotal);
@@ -0,0 +1,124 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DownloadCoordinator.h"
+#include <QFileInfo>
+#include "logger/QsLog.h"
+
+bool DownloadCoordinator::claim(NetActionPtr action, const QString &target)
+{
+	QString key = QFileInfo(target).absoluteFilePath();
+	auto iter = m_transfers.find(key);
+	if (iter == m_transfers.end())
+	{
+		Transfer transfer;
+		transfer.leader = action.get();
+		m_transfers.insert(key, transfer);
+		m_keys.insert(action.get(), key);
+		connect(action.get(), SIGNAL(succeeded(int)), SLOT(leaderSucceeded(int)));
+		connect(action.get(), SIGNAL(failed(int)), SLOT(leaderFailed(int)));
+		connect(action.get(), SIGNAL(destroyed(QObject *)), SLOT(leaderDestroyed(QObject *)));
+		return true;
+	}
+	auto &transfer = *iter;
+	// restarted (redirect, etc.) - it's still ours. the job may have reset its priority
+	if (transfer.leader == action.get())
+	{
+		raisePriority(key);
+		return true;
+	}
+	if (!transfer.attached.contains(action))
+	{
+		QLOG_INFO() << "Already downloading" << key << "- waiting for it instead of downloading again.";
+		transfer.attached.append(action);
+		connect(transfer.leader, SIGNAL(progress(int, qint64, qint64)), action.get(),
+				SLOT(attachedProgress(int, qint64, qint64)));
+		raisePriority(key);
+		// it doesn't use the network until the leader is done
+		emit action->attached(action->m_index_within_job);
+	}
+	return false;
+}
+
+void DownloadCoordinator::raisePriority(const QString &key)
+{
+	auto &transfer = m_transfers[key];
+	for (auto action : transfer.attached)
+	{
+		if (action->m_priority > transfer.leader->m_priority)
+			transfer.leader->m_priority = action->m_priority;
+	}
+}
+
+int DownloadCoordinator::attachedCount() const
+{
+	int count = 0;
+	for (auto &transfer : m_transfers)
+	{
+		count += transfer.attached.size();
+	}
+	return count;
+}
+
+void DownloadCoordinator::leaderSucceeded(int)
+{
+	leaderDone(qobject_cast<NetAction *>(sender()), true);
+}
+
+void DownloadCoordinator::leaderFailed(int)
+{
+	leaderDone(qobject_cast<NetAction *>(sender()), false);
+}
+
+void DownloadCoordinator::leaderDestroyed(QObject *leader)
+{
+	// the NetAction part is gone already, only the key is left to go by
+	if (!m_keys.contains(leader))
+		return;
+	QString key = m_keys.take(leader);
+	Transfer transfer = m_transfers.take(key);
+	QLOG_WARN() << "Download of" << key << "went away before it finished.";
+	for (auto action : transfer.attached)
+	{
+		action->attachedFailed(nullptr);
+	}
+}
+
+void DownloadCoordinator::leaderDone(NetAction *leader, bool success)
+{
+	if (!leader || !m_keys.contains(leader))
+		return;
+	QString key = m_keys.take(leader);
+	// take the transfer out first. the attached actions may start new downloads when told.
+	Transfer transfer = m_transfers.take(key);
+	if (transfer.leader->m_status == Job_InProgress)
+	{
+		// the leader's job already restarted it. it keeps the file.
+		m_transfers.insert(key, Transfer{transfer.leader, {}});
+		m_keys.insert(leader, key);
+	}
+	else
+	{
+		disconnect(leader, 0, this, 0);
+	}
+	for (auto action : transfer.attached)
+	{
+		disconnect(leader, 0, action.get(), 0);
+		if (success)
+			action->attachedSucceeded(leader);
+		else
+			action->attachedFailed(leader);
+	}
+}
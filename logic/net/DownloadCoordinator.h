@@ -0,0 +1,76 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QMap>
+#include <QHash>
+#include <QList>
+#include "NetAction.h"
+
+/**
+ * Makes sure a file is only downloaded once at a time, no matter how many jobs want it.
+ *
+ * Downloads that write into a file claim it before going to the network. The first claim
+ * wins and does the actual transfer. Anyone claiming the same file while that is running
+ * gets attached to it instead: it mirrors the progress of the running download and finishes
+ * when it does.
+ *
+ * Downloads are keyed on the target file, not the URL - two downloads writing the same file
+ * would clobber each other anyway, and Forge libraries come from randomly ordered mirrors.
+ *
+ * The running download gets the highest priority of everyone waiting for it, so a launch
+ * doesn't wait at background speed for a download some background job started. If it goes
+ * away without finishing, the ones waiting for it fail and get retried by their jobs.
+ */
+class DownloadCoordinator : public QObject
+{
+	Q_OBJECT
+public:
+	explicit DownloadCoordinator(QObject *parent = 0) : QObject(parent) {};
+	virtual ~DownloadCoordinator() {};
+
+	/**
+	 * Claim the target file for the action.
+	 * Returns true if the action should go ahead with the download. Returns false if it was
+	 * attached to an identical download that is already running.
+	 */
+	bool claim(NetActionPtr action, const QString &target);
+
+	/// number of downloads currently waiting on another one
+	int attachedCount() const;
+
+private
+slots:
+	void leaderSucceeded(int);
+	void leaderFailed(int);
+	void leaderDestroyed(QObject *leader);
+
+private:
+	void leaderDone(NetAction *leader, bool success);
+	/// give the leader the priority of the most urgent action waiting for it
+	void raisePriority(const QString &key);
+
+private:
+	struct Transfer
+	{
+		/// not owned, the leader's job decides how long it lives
+		NetAction *leader;
+		QList<NetActionPtr> attached;
+	};
+	QMap<QString, Transfer> m_transfers;
+	QHash<QObject *, QString> m_keys;
+};
@@ -0,0 +1,221 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DownloadSink.h"
+
+#include <QCoreApplication>
+#include <QThreadPool>
+#include <QRunnable>
+#include "logger/QsLog.h"
+
+// size of one buffer. the same as the read buffer of metered replies
+static const int chunkSize = 64 * 1024;
+
+// all sinks share one writer thread, which also keeps the writes of each sink in order
+static QThreadPool *writerPool()
+{
+	static QThreadPool *pool = nullptr;
+	if (!pool)
+	{
+		pool = new QThreadPool(QCoreApplication::instance());
+		pool->setMaxThreadCount(1);
+	}
+	return pool;
+}
+
+class SinkWriteTask : public QRunnable
+{
+public:
+	/// index -1 hashes the data already in the file
+	SinkWriteTask(DownloadSink *sink, int index) : m_sink(sink), m_index(index)
+	{
+	}
+	virtual void run()
+	{
+		if (m_index < 0)
+			m_sink->hashFile();
+		else
+			m_sink->writeChunk(m_index);
+	}
+
+private:
+	DownloadSink *m_sink;
+	int m_index;
+};
+
+DownloadSink::DownloadSink(QObject *parent) : QObject(parent)
+{
+}
+
+DownloadSink::DownloadSink(QCryptographicHash::Algorithm algorithm, QObject *parent)
+	: QObject(parent), m_hash(new QCryptographicHash(algorithm))
+{
+}
+
+DownloadSink::~DownloadSink()
+{
+	// the writer may still use the buffers
+	waitForWriter();
+}
+
+void DownloadSink::begin(QFile *file, bool hashExisting)
+{
+	waitForWriter();
+	m_file = file;
+	m_fill = 0;
+	m_filled = 0;
+	m_failed = false;
+	m_starved = false;
+	if (m_hash)
+	{
+		m_hash->reset();
+		if (hashExisting)
+		{
+			QMutexLocker locker(&m_mutex);
+			m_queued++;
+			writerPool()->start(new SinkWriteTask(this, -1));
+		}
+	}
+}
+
+bool DownloadSink::readFrom(QIODevice *device)
+{
+	if (!m_file)
+		return false;
+	if (!m_buffer)
+		m_buffer.reset(new char[chunkSize * chunkCount]);
+	while (true)
+	{
+		{
+			QMutexLocker locker(&m_mutex);
+			if (m_failed)
+				return false;
+			// everything is waiting for the writer. leave the rest in the device for now
+			if (m_queued >= chunkCount)
+			{
+				m_starved = true;
+				return true;
+			}
+		}
+		char *chunk = m_buffer.get() + m_fill * chunkSize;
+		qint64 read = device->read(chunk + m_filled, chunkSize - m_filled);
+		if (read <= 0)
+			return true;
+		m_filled += read;
+		if (m_filled == chunkSize)
+			dispatch();
+	}
+}
+
+void DownloadSink::dispatch()
+{
+	if (!m_filled)
+		return;
+	m_lengths[m_fill] = m_filled;
+	{
+		QMutexLocker locker(&m_mutex);
+		m_queued++;
+	}
+	writerPool()->start(new SinkWriteTask(this, m_fill));
+	m_fill = (m_fill + 1) % chunkCount;
+	m_filled = 0;
+}
+
+void DownloadSink::restart()
+{
+	waitForWriter();
+	m_filled = 0;
+	m_failed = false;
+	if (m_hash)
+		m_hash->reset();
+	if (m_file)
+	{
+		m_file->resize(0);
+		m_file->seek(0);
+	}
+}
+
+bool DownloadSink::finish()
+{
+	dispatch();
+	waitForWriter();
+	m_buffer.reset();
+	m_fill = 0;
+	bool ok = !m_failed;
+	if (m_file && m_file->isOpen() && !m_file->flush())
+		ok = false;
+	// done with this file, begin() gives us the next one
+	m_file = nullptr;
+	return ok;
+}
+
+QByteArray DownloadSink::result()
+{
+	waitForWriter();
+	if (!m_hash)
+		return QByteArray();
+	return m_hash->result();
+}
+
+void DownloadSink::waitForWriter()
+{
+	QMutexLocker locker(&m_mutex);
+	while (m_queued)
+		m_idle.wait(&m_mutex);
+}
+
+void DownloadSink::writeChunk(int index)
+{
+	const char *data = m_buffer.get() + index * chunkSize;
+	int length = m_lengths[index];
+	bool failed;
+	{
+		QMutexLocker locker(&m_mutex);
+		failed = m_failed;
+	}
+	if (!failed)
+	{
+		if (m_hash)
+			m_hash->addData(data, length);
+		if (m_file->write(data, length) != length)
+		{
+			QLOG_ERROR() << "Failed writing into" << m_file->fileName() << ":"
+						 << m_file->errorString();
+			failed = true;
+		}
+	}
+
+	QMutexLocker locker(&m_mutex);
+	if (failed)
+		m_failed = true;
+	m_queued--;
+	if (m_starved)
+	{
+		m_starved = false;
+		// delivered in the sink's thread. dropped if the sink is gone by then.
+		QMetaObject::invokeMethod(this, "bufferFreed", Qt::QueuedConnection);
+	}
+	m_idle.wakeAll();
+}
+
+void DownloadSink::hashFile()
+{
+	bool ok = m_hash->addData(m_file);
+	QMutexLocker locker(&m_mutex);
+	if (!ok)
+		m_failed = true;
+	m_queued--;
+	m_idle.wakeAll();
+}
@@ -0,0 +1,95 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QCryptographicHash>
+#include <memory>
+
+/**
+ * Writes downloaded data to a file behind the back of the GUI thread.
+ *
+ * Data is read from the reply straight into a small ring of fixed size buffers. Full buffers
+ * are hashed and written by a writer thread shared by all sinks, so the GUI thread only copies
+ * memory. When all buffers are waiting for the writer, the sink stops taking data. The rest
+ * stays in the reply until bufferFreed() is emitted.
+ *
+ * All methods are meant to be called from the thread the sink lives in.
+ */
+class DownloadSink : public QObject
+{
+	Q_OBJECT
+public:
+	/// a sink that doesn't hash anything
+	explicit DownloadSink(QObject *parent = 0);
+	explicit DownloadSink(QCryptographicHash::Algorithm algorithm, QObject *parent = 0);
+	virtual ~DownloadSink();
+
+	/**
+	 * Start writing into the file, which has to be open already.
+	 * With hashExisting, the data already in the file is hashed first (on the writer thread).
+	 * Don't touch the file until finish() is called.
+	 */
+	void begin(QFile *file, bool hashExisting = false);
+
+	/// take as much of the data waiting in the device as there is room for. false on errors
+	bool readFrom(QIODevice *device);
+
+	/// throw away everything written so far and start over with an empty file
+	void restart();
+
+	/// write out everything and wait for it. false if anything couldn't be written
+	bool finish();
+
+	/// hash of everything written, valid after finish()
+	QByteArray result();
+
+signals:
+	/// the writer made room for more data
+	void bufferFreed();
+
+private:
+	/// buffers in the ring
+	static const int chunkCount = 4;
+
+	friend class SinkWriteTask;
+	/// hand the buffer being filled over to the writer
+	void dispatch();
+	void waitForWriter();
+	/// these run on the writer thread
+	void writeChunk(int index);
+	void hashFile();
+
+private:
+	std::unique_ptr<QCryptographicHash> m_hash;
+	QFile *m_file = nullptr;
+	/// the ring of buffers, allocated on first use and released by finish()
+	std::unique_ptr<char[]> m_buffer;
+	int m_lengths[chunkCount];
+	/// the buffer being filled, and how much is in it
+	int m_fill = 0;
+	int m_filled = 0;
+
+	/// shared with the writer thread
+	QMutex m_mutex;
+	QWaitCondition m_idle;
+	int m_queued = 0;
+	bool m_failed = false;
+	bool m_starved = false;
+};
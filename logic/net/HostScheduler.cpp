@@ -0,0 +1,283 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "HostScheduler.h"
+#include "logic/settings/SettingsObject.h"
+#include "logic/settings/Setting.h"
+#include "logger/QsLog.h"
+
+#include <QDateTime>
+
+// how often the limits are re-evaluated
+static const int sampleInterval = 1000;
+// weight of the newest sample in the smoothed throughput
+static const double throughputSmoothing = 0.3;
+// growth in throughput needed to keep raising the limit
+static const double probeGain = 1.05;
+// loss in throughput that makes us undo the last raise
+static const double probeLoss = 0.85;
+// failures in a row that make us pause a host
+static const int breakerThreshold = 5;
+// how long a host is paused the first time, and at most
+static const qint64 breakerCooldown = 15000;
+static const qint64 breakerMaxCooldown = 300000;
+
+HostScheduler::HostScheduler(QObject *parent) : QObject(parent)
+{
+	loadSettings();
+	connect(MMC->settings().get(), SIGNAL(SettingChanged(const Setting &, QVariant)),
+			SLOT(SettingChanged(const Setting &, QVariant)));
+	m_sampleTimer.setInterval(sampleInterval);
+	connect(&m_sampleTimer, SIGNAL(timeout()), SLOT(sample()));
+	m_breakerTimer.setSingleShot(true);
+	connect(&m_breakerTimer, SIGNAL(timeout()), SLOT(breakerTimeout()));
+}
+
+void HostScheduler::loadSettings()
+{
+	auto s = MMC->settings();
+	m_adaptive = s->get("NetHostAdaptiveConcurrency").toBool();
+	m_minLimit = qMax(1, s->get("NetHostMinConcurrency").toInt());
+	m_maxLimit = qMax(m_minLimit, s->get("NetHostMaxConcurrency").toInt());
+	m_initialLimit = qBound(m_minLimit, s->get("NetHostInitialConcurrency").toInt(), m_maxLimit);
+}
+
+void HostScheduler::SettingChanged(const Setting &setting, QVariant)
+{
+	if (!setting.id().startsWith("NetHost"))
+		return;
+
+	loadSettings();
+	for (auto &state : m_hosts)
+	{
+		if (m_adaptive)
+			state.limit = qBound<double>(m_minLimit, state.limit, m_maxLimit);
+		else
+			state.limit = m_initialLimit;
+	}
+	emit stateChanged();
+	emit slotsAvailable();
+}
+
+HostState &HostScheduler::stateFor(const QString &host)
+{
+	auto iter = m_hosts.find(host);
+	if (iter == m_hosts.end())
+	{
+		HostState state;
+		state.host = host;
+		state.limit = m_initialLimit;
+		iter = m_hosts.insert(host, state);
+	}
+	return *iter;
+}
+
+bool HostScheduler::tryAcquire(const QString &host, int *generation)
+{
+	auto &state = stateFor(host);
+	if (state.paused_until)
+	{
+		if (QDateTime::currentMSecsSinceEpoch() < state.paused_until)
+			return false;
+		// the pause is over - let a single request through to see if the host is back
+		if (state.in_flight)
+			return false;
+	}
+	if (state.in_flight >= state.effectiveLimit())
+	{
+		state.window_saturated = true;
+		return false;
+	}
+	state.in_flight++;
+	if (generation)
+		*generation = state.generation;
+	if (state.in_flight >= state.effectiveLimit())
+		state.window_saturated = true;
+	if (!m_sampleTimer.isActive())
+	{
+		m_sampleClock.start();
+		m_sampleTimer.start();
+	}
+	emit stateChanged();
+	return true;
+}
+
+void HostScheduler::release(const QString &host, bool success, int generation)
+{
+	auto &state = stateFor(host);
+	if (state.in_flight > 0)
+		state.in_flight--;
+	// started before the last trip. it says nothing about the probe, or the pause it caused
+	bool stale = generation != state.generation;
+	if (success)
+	{
+		state.successes++;
+		if (!stale)
+		{
+			state.consecutive_failures = 0;
+			if (state.paused_until)
+			{
+				QLOG_INFO() << "Host" << state.host << "is working again.";
+				state.paused_until = 0;
+				state.trips = 0;
+			}
+		}
+	}
+	else
+	{
+		state.errors++;
+		state.window_errors++;
+		if (!stale)
+		{
+			state.consecutive_failures++;
+			qint64 now = QDateTime::currentMSecsSinceEpoch();
+			bool probing = state.paused_until && now >= state.paused_until;
+			if (probing ||
+				(!state.paused_until && state.consecutive_failures >= breakerThreshold))
+			{
+				trip(state);
+			}
+		}
+	}
+	emit stateChanged();
+	emit slotsAvailable();
+}
+
+void HostScheduler::cancel(const QString &host)
+{
+	auto &state = stateFor(host);
+	if (state.in_flight > 0)
+		state.in_flight--;
+	emit stateChanged();
+	emit slotsAvailable();
+}
+
+void HostScheduler::reportBytes(const QString &host, qint64 bytes)
+{
+	auto &state = stateFor(host);
+	state.window_bytes += bytes;
+	state.total_bytes += bytes;
+}
+
+void HostScheduler::sample()
+{
+	qint64 elapsed = m_sampleClock.restart();
+	if (elapsed <= 0)
+		return;
+
+	bool anyActive = false;
+	bool raised = false;
+	for (auto &state : m_hosts)
+	{
+		double current = double(state.window_bytes) * 1000.0 / double(elapsed);
+		if (state.in_flight || state.window_bytes)
+		{
+			state.throughput = state.throughput * (1.0 - throughputSmoothing) +
+							   current * throughputSmoothing;
+		}
+
+		if (m_adaptive)
+		{
+			if (state.window_errors)
+			{
+				// multiplicative decrease
+				state.limit = qMax<double>(m_minLimit, state.limit / 2.0);
+				state.probe_throughput = state.throughput;
+				QLOG_DEBUG() << "Host" << state.host << "had errors, limit lowered to"
+							 << state.effectiveLimit();
+			}
+			else if (state.window_saturated && state.window_bytes)
+			{
+				if (state.throughput >= state.probe_throughput * probeGain)
+				{
+					// additive increase - more parallelism still helps
+					if (state.limit + 1 <= m_maxLimit)
+					{
+						state.limit += 1;
+						raised = true;
+					}
+					state.probe_throughput = state.throughput;
+				}
+				else if (state.throughput < state.probe_throughput * probeLoss)
+				{
+					// the last raise made things worse, give the slot back
+					state.limit = qMax<double>(m_minLimit, state.limit - 1);
+					state.probe_throughput = state.throughput;
+				}
+			}
+		}
+
+		state.window_bytes = 0;
+		state.window_errors = 0;
+		state.window_saturated = state.in_flight >= state.effectiveLimit();
+		if (state.in_flight)
+			anyActive = true;
+	}
+	if (!anyActive)
+		m_sampleTimer.stop();
+	emit stateChanged();
+	if (raised)
+		emit slotsAvailable();
+}
+
+QList<HostState> HostScheduler::hosts() const
+{
+	return m_hosts.values();
+}
+
+bool HostScheduler::isTripped(const QString &host) const
+{
+	auto iter = m_hosts.find(host);
+	if (iter == m_hosts.end())
+		return false;
+	return (*iter).paused_until > QDateTime::currentMSecsSinceEpoch();
+}
+
+void HostScheduler::trip(HostState &state)
+{
+	state.trips++;
+	state.generation++;
+	qint64 cooldown = qMin(breakerMaxCooldown, breakerCooldown << qMin(state.trips - 1, 8));
+	state.paused_until = QDateTime::currentMSecsSinceEpoch() + cooldown;
+	QLOG_WARN() << "Host" << state.host << "failed" << state.consecutive_failures
+				<< "times in a row, pausing it for" << cooldown / 1000 << "seconds.";
+	scheduleBreakerTimer();
+}
+
+void HostScheduler::scheduleBreakerTimer()
+{
+	qint64 now = QDateTime::currentMSecsSinceEpoch();
+	qint64 next = 0;
+	for (auto &state : m_hosts)
+	{
+		if (state.paused_until > now && (!next || state.paused_until < next))
+			next = state.paused_until;
+	}
+	if (!next)
+	{
+		m_breakerTimer.stop();
+		return;
+	}
+	m_breakerTimer.start(int(next - now));
+}
+
+void HostScheduler::breakerTimeout()
+{
+	// some pause is over, the jobs can try that host again
+	scheduleBreakerTimer();
+	emit stateChanged();
+	emit slotsAvailable();
+}
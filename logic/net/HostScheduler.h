@@ -0,0 +1,141 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QVariant>
+#include <QMap>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <memory>
+
+class Setting;
+
+/// Live concurrency state of a single remote host
+struct HostState
+{
+	QString host;
+	/// current limit on parallel requests. fractional, so it can be halved and grown smoothly
+	double limit = 6;
+	/// number of requests currently running against this host (across all jobs)
+	int in_flight = 0;
+	/// smoothed throughput in bytes per second
+	double throughput = 0;
+	/// the throughput we had when the limit was last raised
+	double probe_throughput = 0;
+	/// totals, for the debug view
+	qint64 total_bytes = 0;
+	int successes = 0;
+	int errors = 0;
+
+	/// failed requests in a row, for the circuit breaker
+	int consecutive_failures = 0;
+	/// how many times in a row the breaker tripped
+	int trips = 0;
+	/// until when the host is paused, in ms since epoch. 0 if the breaker is closed
+	qint64 paused_until = 0;
+	/// goes up every time the breaker trips. slots are tagged with it
+	int generation = 0;
+
+	/// data collected during the current sampling window
+	qint64 window_bytes = 0;
+	int window_errors = 0;
+	bool window_saturated = false;
+
+	int effectiveLimit() const
+	{
+		return qMax(1, int(limit));
+	}
+};
+
+/**
+ * Decides how many requests may run against each host at once.
+ *
+ * Every host starts with the configured initial limit. While adaptive mode is on, the
+ * limits are adjusted AIMD-style once per sampling interval:
+ *  - any error during the interval halves the limit
+ *  - a saturated host whose throughput keeps growing gets one more slot
+ *  - a saturated host whose throughput dropped after growing gives the slot back
+ *
+ * The limits are shared by all NetJobs, so two jobs hitting the same server don't double
+ * the load on it.
+ *
+ * There's also a circuit breaker for each host: after enough failures in a row, the host is
+ * paused for a while and the jobs work on parts for other hosts instead. Once the pause is
+ * over, a single request is let through. If it works, the host is back, otherwise it gets
+ * paused again, for longer.
+ */
+class HostScheduler : public QObject
+{
+	Q_OBJECT
+public:
+	explicit HostScheduler(QObject *parent = 0);
+	virtual ~HostScheduler() {};
+
+	/**
+	 * Try to take a request slot for the host. Returns false if the host is at its limit.
+	 * The breaker generation the slot was taken in goes to generation, for release().
+	 */
+	bool tryAcquire(const QString &host, int *generation = nullptr);
+
+	/**
+	 * Give back a slot taken by tryAcquire.
+	 * Results of requests started before the breaker last tripped don't affect the breaker.
+	 */
+	void release(const QString &host, bool success, int generation);
+
+	/// give back a slot that wasn't used for a request after all. Neither success nor failure
+	void cancel(const QString &host);
+
+	/// account bytes received from the host
+	void reportBytes(const QString &host, qint64 bytes);
+
+	/// snapshot of all known hosts, for display
+	QList<HostState> hosts() const;
+
+	/// true if the host is paused by the circuit breaker
+	bool isTripped(const QString &host) const;
+
+signals:
+	/// a slot was freed or a limit was raised. Connect to this with a queued connection.
+	void slotsAvailable();
+	/// some host state changed. used by the debug view.
+	void stateChanged();
+
+private
+slots:
+	void sample();
+	void breakerTimeout();
+	void SettingChanged(const Setting &setting, QVariant value);
+
+private:
+	HostState &stateFor(const QString &host);
+	void loadSettings();
+	void trip(HostState &state);
+	void scheduleBreakerTimer();
+
+private:
+	QMap<QString, HostState> m_hosts;
+	QTimer m_sampleTimer;
+	QElapsedTimer m_sampleClock;
+	QTimer m_breakerTimer;
+
+	bool m_adaptive = true;
+	int m_initialLimit = 6;
+	int m_minLimit = 1;
+	int m_maxLimit = 16;
+};
@@ -23,6 +23,9 @@
 #include <QSaveFile>
 #include <QDateTime>
 #include <QCryptographicHash>
+#include <QDataStream>
+#include <QThread>
+#include <QtConcurrentMap>
 
 #include "logger/QsLog.h"
 
@@ -30,12 +33,21 @@
 #include <QJsonArray>
 #include <QJsonObject>
 
+// first bytes of the journal file
+static const QByteArray journalMagic("MMCMETA2");
+// size of the record header: payload length and checksum
+static const int recordHeaderSize = 6;
+// dead records tolerated before the journal is compacted
+static const int compactSlack = 1000;
+// how old the recorded last access may get before a use of the entry is written down
+static const qint64 touchInterval = 3600 * 1000;
+
 QString MetaEntry::getFullPath()
 {
 	return PathCombine(MMC->metacache()->getBasePath(base), path);
 }
 
-HttpMetaCache::HttpMetaCache(QString path) : QObject()
+HttpMetaCache::HttpMetaCache(QString path) : QObject(), m_mutex(QMutex::Recursive)
 {
 	m_index_file = path;
 	saveBatchingTimer.setSingleShot(true);
@@ -51,6 +63,7 @@ HttpMetaCache::~HttpMetaCache()
 
 MetaEntryPtr HttpMetaCache::getEntry(QString base, QString resource_path)
 {
+	QMutexLocker locker(&m_mutex);
 	// no base. no base path. can't store
 	if (!m_entries.contains(base))
 	{
@@ -65,9 +78,28 @@ MetaEntryPtr HttpMetaCache::getEntry(QString base, QString resource_path)
 	return MetaEntryPtr();
 }
 
+// hash a file without loading all of it into memory
+static QString md5File(const QString &path)
+{
+	QFile input(path);
+	if (!input.open(QIODevice::ReadOnly))
+		return QString();
+	QCryptographicHash md5(QCryptographicHash::Md5);
+	char buffer[64 * 1024];
+	qint64 read;
+	while ((read = input.read(buffer, sizeof(buffer))) > 0)
+	{
+		md5.addData(buffer, read);
+	}
+	if (read < 0)
+		return QString();
+	return md5.result().toHex().constData();
+}
+
 MetaEntryPtr HttpMetaCache::resolveEntry(QString base, QString resource_path,
 										 QString expected_etag)
 {
+	QMutexLocker locker(&m_mutex);
 	auto entry = getEntry(base, resource_path);
 	// it's not present? generate a default stale entry
 	if (!entry)
@@ -83,33 +115,54 @@ MetaEntryPtr HttpMetaCache::resolveEntry(QString base, QString resource_path,
 	if (!finfo.isFile() || !finfo.isReadable())
 	{
 		// if the file doesn't exist, we disown the entry
-		selected_base.entry_list.remove(resource_path);
+		dropEntry(base, resource_path);
 		return staleEntry(base, resource_path);
 	}
 
 	if (!expected_etag.isEmpty() && expected_etag != entry->etag)
 	{
 		// if the etag doesn't match expected, we disown the entry
-		selected_base.entry_list.remove(resource_path);
+		dropEntry(base, resource_path);
 		return staleEntry(base, resource_path);
 	}
 
+	bool changed = false;
 	// if the file changed, check md5sum
 	qint64 file_last_changed = finfo.lastModified().toUTC().toMSecsSinceEpoch();
 	if (file_last_changed != entry->local_changed_timestamp)
 	{
-		QFile input(real_path);
-		input.open(QIODevice::ReadOnly);
-		QString md5sum = QCryptographicHash::hash(input.readAll(), QCryptographicHash::Md5)
-							 .toHex()
-							 .constData();
-		if (entry->md5sum != md5sum)
+		// don't block other threads while hashing
+		QString expected_md5 = entry->md5sum;
+		locker.unlock();
+		QString md5sum = md5File(real_path);
+		locker.relock();
+
+		// somebody else changed the entry in the meantime, start over
+		if (getEntry(base, resource_path) != entry)
 		{
-			selected_base.entry_list.remove(resource_path);
+			locker.unlock();
+			return resolveEntry(base, resource_path, expected_etag);
+		}
+		if (md5sum.isEmpty() || expected_md5 != md5sum)
+		{
+			dropEntry(base, resource_path);
 			return staleEntry(base, resource_path);
 		}
 		// md5sums matched... keep entry and save the new state to file
 		entry->local_changed_timestamp = file_last_changed;
+		changed = true;
+	}
+
+	// remember the use, but don't write a record every time
+	qint64 now = QDateTime::currentMSecsSinceEpoch();
+	if (now - entry->last_access > touchInterval)
+	{
+		entry->last_access = now;
+		changed = true;
+	}
+	if (changed)
+	{
+		appendRecord(Record_Put, entry);
 		SaveEventually();
 	}
 
@@ -117,8 +170,27 @@ MetaEntryPtr HttpMetaCache::resolveEntry(QString base, QString resource_path,
 	return entry;
 }
 
+namespace
+{
+struct AsyncResolve
+{
+	typedef MetaEntryPtr result_type;
+	HttpMetaCache *cache;
+	MetaEntryPtr operator()(const MetaEntryRequest &request) const
+	{
+		return cache->resolveEntry(request.base, request.path, request.expected_etag);
+	}
+};
+}
+
+QFuture<MetaEntryPtr> HttpMetaCache::resolveEntriesAsync(QList<MetaEntryRequest> requests)
+{
+	return QtConcurrent::mapped(requests, AsyncResolve{this});
+}
+
 bool HttpMetaCache::updateEntry(MetaEntryPtr stale_entry)
 {
+	QMutexLocker locker(&m_mutex);
 	if (!m_entries.contains(stale_entry->base))
 	{
 		QLOG_ERROR() << "Cannot add entry with unknown base: "
@@ -130,11 +202,48 @@ bool HttpMetaCache::updateEntry(MetaEntryPtr stale_entry)
 		QLOG_ERROR() << "Cannot add stale entry: " << stale_entry->getFullPath().toLocal8Bit();
 		return false;
 	}
+	stale_entry->last_access = QDateTime::currentMSecsSinceEpoch();
 	m_entries[stale_entry->base].entry_list[stale_entry->path] = stale_entry;
+	appendRecord(Record_Put, stale_entry);
 	SaveEventually();
 	return true;
 }
 
+QList<MetaEntryPtr> HttpMetaCache::entries(QString base)
+{
+	QMutexLocker locker(&m_mutex);
+	if (!m_entries.contains(base))
+		return QList<MetaEntryPtr>();
+	return m_entries[base].entry_list.values();
+}
+
+bool HttpMetaCache::evictEntry(MetaEntryPtr entry)
+{
+	QMutexLocker locker(&m_mutex);
+	// it was replaced or dropped meanwhile
+	if (getEntry(entry->base, entry->path) != entry)
+		return false;
+	QFile file(PathCombine(m_entries[entry->base].base_path, entry->path));
+	if (file.exists() && !file.remove())
+	{
+		QLOG_WARN() << "Cannot remove" << file.fileName() << ":" << file.errorString();
+		return false;
+	}
+	dropEntry(entry->base, entry->path);
+	return true;
+}
+
+void HttpMetaCache::dropEntry(QString base, QString resource_path)
+{
+	auto &selected_base = m_entries[base];
+	auto entry = selected_base.entry_list.take(resource_path);
+	if (entry)
+	{
+		appendRecord(Record_Remove, entry);
+		SaveEventually();
+	}
+}
+
 MetaEntryPtr HttpMetaCache::staleEntry(QString base, QString resource_path)
 {
 	auto foo = new MetaEntry;
@@ -144,19 +253,37 @@ MetaEntryPtr HttpMetaCache::staleEntry(QString base, QString resource_path)
 	return MetaEntryPtr(foo);
 }
 
-void HttpMetaCache::addBase(QString base, QString base_root)
+void HttpMetaCache::addBase(QString base, QString base_root, bool metadata)
 {
+	QMutexLocker locker(&m_mutex);
 	// TODO: report error
 	if (m_entries.contains(base))
 		return;
 	// TODO: check if the base path is valid
 	EntryMap foo;
 	foo.base_path = base_root;
+	foo.metadata = metadata;
 	m_entries[base] = foo;
 }
 
+void HttpMetaCache::setCompressMetadata(bool compress)
+{
+	QMutexLocker locker(&m_mutex);
+	m_compress_metadata = compress;
+}
+
+bool HttpMetaCache::storesCompressed(MetaEntryPtr entry)
+{
+	QMutexLocker locker(&m_mutex);
+	if (!m_compress_metadata || !m_entries.contains(entry->base))
+		return false;
+	// other files in metadata bases, like the forge installers, are used as they are
+	return m_entries[entry->base].metadata && entry->path.endsWith(".json");
+}
+
 QString HttpMetaCache::getBasePath(QString base)
 {
+	QMutexLocker locker(&m_mutex);
 	if (m_entries.contains(base))
 	{
 		return m_entries[base].base_path;
@@ -166,11 +293,78 @@ QString HttpMetaCache::getBasePath(QString base)
 
 void HttpMetaCache::Load()
 {
+	QMutexLocker locker(&m_mutex);
 	QFile index(m_index_file);
 	if (!index.open(QIODevice::ReadOnly))
 		return;
 
-	QJsonDocument json = QJsonDocument::fromJson(index.readAll());
+	// the old format was a single JSON document
+	if (index.peek(1) == "{")
+	{
+		LoadV1(index.readAll());
+		index.close();
+		QLOG_INFO() << "Converting the metacache index to the journal format.";
+		Compact();
+		return;
+	}
+
+	qint64 size = index.size();
+	if (size == 0)
+	{
+		index.close();
+		openJournal();
+		return;
+	}
+	QByteArray buffer;
+	const char *data = (const char *)index.map(0, size);
+	if (!data)
+	{
+		buffer = index.readAll();
+		data = buffer.constData();
+	}
+
+	if (size < journalMagic.size() ||
+		QByteArray::fromRawData(data, journalMagic.size()) != journalMagic)
+	{
+		QLOG_ERROR() << "The metacache index" << m_index_file << "is not valid, starting over.";
+		index.close();
+		Compact();
+		return;
+	}
+
+	qint64 offset = journalMagic.size();
+	m_journal_records = 0;
+	while (offset + recordHeaderSize <= size)
+	{
+		const uchar *header = (const uchar *)data + offset;
+		quint32 length = (quint32(header[0]) << 24) | (quint32(header[1]) << 16) |
+						 (quint32(header[2]) << 8) | quint32(header[3]);
+		quint16 checksum = (quint16(header[4]) << 8) | quint16(header[5]);
+		if (length > size - offset - recordHeaderSize)
+			break;
+		const char *payload = data + offset + recordHeaderSize;
+		if (qChecksum(payload, length) != checksum)
+			break;
+		if (!applyRecord(QByteArray::fromRawData(payload, length)))
+			break;
+		offset += recordHeaderSize + length;
+		m_journal_records++;
+	}
+	index.close();
+
+	// a record that was only partially written when we were killed. cut it off.
+	if (offset != size)
+	{
+		QLOG_WARN() << "Dropping" << size - offset << "bytes of damaged records from"
+					<< m_index_file;
+		QFile::resize(m_index_file, offset);
+	}
+	openJournal();
+}
+
+void HttpMetaCache::LoadV1(const QByteArray &data)
+{
+	QJsonDocument json = QJsonDocument::fromJson(data);
 	if (!json.isObject())
 		return;
 	auto root = json.object();
@@ -203,51 +397,148 @@ void HttpMetaCache::Load()
 		foo->local_changed_timestamp = element_obj.value("last_changed_timestamp").toDouble();
 		foo->remote_changed_timestamp =
 			element_obj.value("remote_changed_timestamp").toString();
+		foo->last_access = foo->local_changed_timestamp;
 		// presumed innocent until closer examination
 		foo->stale = false;
 		entrymap.entry_list[path] = MetaEntryPtr(foo);
 	}
 }
 
-void HttpMetaCache::SaveEventually()
+bool HttpMetaCache::applyRecord(const QByteArray &payload)
 {
-	// reset the save timer
-	saveBatchingTimer.stop();
-	saveBatchingTimer.start(30000);
+	QDataStream in(payload);
+	in.setVersion(QDataStream::Qt_5_0);
+	quint8 type;
+	QString base, path;
+	in >> type >> base >> path;
+	if (type == Record_Put)
+	{
+		auto foo = new MetaEntry;
+		foo->base = base;
+		foo->path = path;
+		in >> foo->md5sum >> foo->etag >> foo->local_changed_timestamp >>
+			foo->remote_changed_timestamp;
+		// added later. records without it count as used when the file was written
+		if (!in.atEnd())
+			in >> foo->last_access;
+		else
+			foo->last_access = foo->local_changed_timestamp;
+		// presumed innocent until closer examination
+		foo->stale = false;
+		MetaEntryPtr entry(foo);
+		if (in.status() != QDataStream::Ok)
+			return false;
+		// entries of bases we don't know anymore are dropped at the next compaction
+		if (m_entries.contains(base))
+			m_entries[base].entry_list[path] = entry;
+		return true;
+	}
+	if (type == Record_Remove)
+	{
+		if (in.status() != QDataStream::Ok)
+			return false;
+		if (m_entries.contains(base))
+			m_entries[base].entry_list.remove(path);
+		return true;
+	}
+	return false;
 }
 
-void HttpMetaCache::SaveNow()
+bool HttpMetaCache::openJournal()
+{
+	if (m_journal.isOpen())
+		return true;
+	m_journal.setFileName(m_index_file);
+	if (!m_journal.open(QIODevice::WriteOnly | QIODevice::Append))
+	{
+		QLOG_ERROR() << "Cannot open the metacache index" << m_index_file << "for writing.";
+		return false;
+	}
+	if (m_journal.size() == 0)
+	{
+		m_journal.write(journalMagic);
+		m_journal_records = 0;
+	}
+	return true;
+}
+
+QByteArray HttpMetaCache::serializeRecord(RecordType type, MetaEntryPtr entry)
 {
+	QByteArray payload;
+	QDataStream out(&payload, QIODevice::WriteOnly);
+	out.setVersion(QDataStream::Qt_5_0);
+	out << quint8(type) << entry->base << entry->path;
+	if (type == Record_Put)
+	{
+		out << entry->md5sum << entry->etag << entry->local_changed_timestamp
+			<< entry->remote_changed_timestamp << entry->last_access;
+	}
+
+	QByteArray record;
+	QDataStream header(&record, QIODevice::WriteOnly);
+	header << quint32(payload.size()) << quint16(qChecksum(payload.constData(), payload.size()));
+	record.append(payload);
+	return record;
+}
+
+void HttpMetaCache::appendRecord(RecordType type, MetaEntryPtr entry)
+{
+	if (!openJournal())
+		return;
+	m_journal.write(serializeRecord(type, entry));
+	// keep the file consistent with memory, in case we crash
+	m_journal.flush();
+	m_journal_records++;
+}
+
+void HttpMetaCache::Compact()
+{
+	m_journal.close();
 	QSaveFile tfile(m_index_file);
 	if (!tfile.open(QIODevice::WriteOnly | QIODevice::Truncate))
 		return;
-	QJsonObject toplevel;
-	toplevel.insert("version", QJsonValue(QString("1")));
-	QJsonArray entriesArr;
+	tfile.write(journalMagic);
+	int records = 0;
 	for (auto group : m_entries)
 	{
 		for (auto entry : group.entry_list)
 		{
-			QJsonObject entryObj;
-			entryObj.insert("base", QJsonValue(entry->base));
-			entryObj.insert("path", QJsonValue(entry->path));
-			entryObj.insert("md5sum", QJsonValue(entry->md5sum));
-			entryObj.insert("etag", QJsonValue(entry->etag));
-			entryObj.insert("last_changed_timestamp",
-							QJsonValue(double(entry->local_changed_timestamp)));
-			if (!entry->remote_changed_timestamp.isEmpty())
-				entryObj.insert("remote_changed_timestamp",
-								QJsonValue(entry->remote_changed_timestamp));
-			entriesArr.append(entryObj);
+			tfile.write(serializeRecord(Record_Put, entry));
+			records++;
 		}
 	}
-	toplevel.insert("entries", entriesArr);
-	QJsonDocument doc(toplevel);
-	QByteArray jsonData = doc.toJson();
-	qint64 result = tfile.write(jsonData);
-	if (result == -1)
+	if (tfile.commit())
+		m_journal_records = records;
+	openJournal();
+}
+
+void HttpMetaCache::SaveEventually()
+{
+	// the timer lives in our thread
+	if (QThread::currentThread() != thread())
+	{
+		QMetaObject::invokeMethod(this, "SaveEventually", Qt::QueuedConnection);
 		return;
-	if (result != jsonData.size())
+	}
+	// reset the save timer
+	saveBatchingTimer.stop();
+	saveBatchingTimer.start(30000);
+}
+
+void HttpMetaCache::SaveNow()
+{
+	QMutexLocker locker(&m_mutex);
+	int live = 0;
+	for (auto &group : m_entries)
+	{
+		live += group.entry_list.size();
+	}
+	// most records are dead - updated or removed entries. rewrite the file.
+	if (m_journal_records > 2 * live + compactSlack)
+	{
+		Compact();
 		return;
-	tfile.commit();
+	}
+	if (m_journal.isOpen())
+		m_journal.flush();
 }
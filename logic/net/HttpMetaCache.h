@@ -16,7 +16,11 @@
 #pragma once
 #include <QString>
 #include <QMap>
+#include <QFile>
+#include <QMutex>
+#include <QFuture>
 #include <qtimer.h>
+#include <memory>
 
 struct MetaEntry
 {
@@ -26,12 +30,24 @@ struct MetaEntry
 	QString etag;
 	qint64 local_changed_timestamp = 0;
 	QString remote_changed_timestamp; // QString for now, RFC 2822 encoded time
+	qint64 last_access = 0; // when the entry was last resolved, for the cache collector
 	bool stale = true;
 	QString getFullPath();
 };
 
 typedef std::shared_ptr<MetaEntry> MetaEntryPtr;
 
+// what to resolve, for resolveEntriesAsync
+struct MetaEntryRequest
+{
+	QString base;
+	QString path;
+	QString expected_etag;
+};
+
+// The index is an append-only journal: every change to an entry appends a record to the end
+// of the file, and the whole file is only rewritten when it has collected too many dead records.
+// The old JSON index (version 1) is converted automatically when found.
 class HttpMetaCache : public QObject
 {
 	Q_OBJECT
@@ -45,31 +61,73 @@ public:
 	MetaEntryPtr getEntry(QString base, QString resource_path);
 
 	// get the entry from cache and verify that it isn't stale (within reason)
+	// this may hash the file. Thread safe.
 	MetaEntryPtr resolveEntry(QString base, QString resource_path,
 							  QString expected_etag = QString());
 
+	// resolve many entries on worker threads. Results are in the order of the requests.
+	QFuture<MetaEntryPtr> resolveEntriesAsync(QList<MetaEntryRequest> requests);
+
 	// add a previously resolved stale entry
 	bool updateEntry(MetaEntryPtr stale_entry);
 
-	void addBase(QString base, QString base_root);
+	// all entries of a base, for the cache collector. Thread safe.
+	QList<MetaEntryPtr> entries(QString base);
+
+	// delete the file of an entry and forget the entry. Thread safe.
+	bool evictEntry(MetaEntryPtr entry);
+
+	// metadata bases may have their JSON files stored compressed
+	void addBase(QString base, QString base_root, bool metadata = false);
+
+	// store the JSON files of metadata bases gzip compressed from now on
+	void setCompressMetadata(bool compress);
+	// whether the file of the entry should be stored compressed
+	bool storesCompressed(MetaEntryPtr entry);
 
-	// (re)start a timer that calls SaveNow later.
-	void SaveEventually();
 	void Load();
 	QString getBasePath(QString base);
 public
 slots:
+	// (re)start a timer that calls SaveNow later.
+	void SaveEventually();
+	// flush the journal, compacting it if it has grown too much
 	void SaveNow();
 
 private:
+	enum RecordType : quint8
+	{
+		Record_Put = 1,
+		Record_Remove = 2
+	};
 	// create a new stale entry, given the parameters
 	MetaEntryPtr staleEntry(QString base, QString resource_path);
+	// remove an entry and record its removal
+	void dropEntry(QString base, QString resource_path);
+	static QByteArray serializeRecord(RecordType type, MetaEntryPtr entry);
+	// append one change to the journal
+	void appendRecord(RecordType type, MetaEntryPtr entry);
+	// apply one journal record to the in-memory entries
+	bool applyRecord(const QByteArray &payload);
+	// read the old, JSON based index
+	void LoadV1(const QByteArray &data);
+	// rewrite the journal so it contains only the live entries
+	void Compact();
+	bool openJournal();
 	struct EntryMap
 	{
 		QString base_path;
 		QMap<QString, MetaEntryPtr> entry_list;
+		bool metadata = false;
 	};
 	QMap<QString, EntryMap> m_entries;
 	QString m_index_file;
 	QTimer saveBatchingTimer;
+	// the index file, open for appending
+	QFile m_journal;
+	// number of records in the journal, live or not
+	int m_journal_records = 0;
+	bool m_compress_metadata = false;
+	// guards everything above, entries are resolved from worker threads
+	QMutex m_mutex;
 };
\ No newline at end of file
@@ -15,30 +15,35 @@
 
 #include "MultiMC.h"
 #include "MD5EtagDownload.h"
+#include "DownloadCoordinator.h"
 #include <pathutils.h>
 #include <QCryptographicHash>
+#include <QFileInfo>
 #include "logger/QsLog.h"
 
-MD5EtagDownload::MD5EtagDownload(QUrl url, QString target_path) : NetAction()
+MD5EtagDownload::MD5EtagDownload(QUrl url, QString target_path)
+	: NetAction(), m_sink(QCryptographicHash::Md5)
 {
 	m_url = url;
 	m_target_path = target_path;
 	m_status = Job_NotStarted;
+	connect(&m_sink, SIGNAL(bufferFreed()), SLOT(readMore()));
 }
 
 void MD5EtagDownload::start()
 {
+	m_status = Job_InProgress;
 	QString filename = m_target_path;
-	m_output_file.setFileName(filename);
+	QFile current(filename);
 	// if there already is a file and md5 checking is in effect and it can be opened
-	if (m_output_file.exists() && m_output_file.open(QIODevice::ReadOnly))
+	if (current.exists() && current.open(QIODevice::ReadOnly))
 	{
 		// get the md5 of the local file.
 		m_local_md5 =
-			QCryptographicHash::hash(m_output_file.readAll(), QCryptographicHash::Md5)
+			QCryptographicHash::hash(current.readAll(), QCryptographicHash::Md5)
 				.toHex()
 				.constData();
-		m_output_file.close();
+		current.close();
 		// if we are expecting some md5sum, compare it with the local one
 		if (!m_expected_md5.isEmpty())
 		{
@@ -46,6 +51,7 @@ void MD5EtagDownload::start()
 			if(m_local_md5 == m_expected_md5)
 			{
 				QLOG_INFO() << "Skipping " << m_url.toString() << ": md5 match.";
+				m_status = Job_Finished;
 				emit succeeded(m_index_within_job);
 				return;
 			}
@@ -55,19 +61,42 @@ void MD5EtagDownload::start()
 			// no expected md5. we use the local md5sum as an ETag
 		}
 	}
+	// if another job is already downloading this file, wait for it instead
+	if (!MMC->downloadCoordinator()->claim(getSharedPtr(), m_target_path))
+	{
+		return;
+	}
 	if (!ensureFilePathExists(filename))
 	{
+		m_status = Job_Failed;
 		emit failed(m_index_within_job);
 		return;
 	}
 
 	QNetworkRequest request(m_url);
 
-	QLOG_INFO() << "Downloading " << m_url.toString() << " local MD5: " << m_local_md5;
+	m_checked_response = false;
+	m_resume_offset = 0;
 
-	if(!m_local_md5.isEmpty())
+	// the data goes into a partial file first, so failed attempts can be resumed
+	m_output_file.setFileName(filename + ".part");
+	QFileInfo partial_info(m_output_file.fileName());
+	bool resume = !m_resume_validator.isEmpty() && partial_info.isFile() && partial_info.size();
+	if (resume)
 	{
-		request.setRawHeader(QString("If-None-Match").toLatin1(), m_local_md5.toLatin1());
+		m_resume_offset = partial_info.size();
+		QLOG_INFO() << "Resuming " << m_url.toString() << " at " << m_resume_offset;
+		request.setRawHeader("Range", QString("bytes=%1-").arg(m_resume_offset).toLatin1());
+		request.setRawHeader("If-Range", m_resume_validator);
+	}
+	else
+	{
+		QLOG_INFO() << "Downloading " << m_url.toString() << " local MD5: " << m_local_md5;
+
+		if(!m_local_md5.isEmpty())
+		{
+			request.setRawHeader(QString("If-None-Match").toLatin1(), m_local_md5.toLatin1());
+		}
 	}
 	if(!m_expected_md5.isEmpty())
 		QLOG_INFO() << "Expecting " << m_expected_md5;
@@ -77,11 +106,15 @@ void MD5EtagDownload::start()
 	// Go ahead and try to open the file.
 	// If we don't do this, empty files won't be created, which breaks the updater.
 	// Plus, this way, we don't end up starting a download for a file we can't open.
-	if (!m_output_file.open(QIODevice::WriteOnly))
+	QIODevice::OpenMode mode = resume ? QIODevice::ReadWrite : QIODevice::WriteOnly | QIODevice::Truncate;
+	if (!m_output_file.open(mode))
 	{
+		m_status = Job_Failed;
 		emit failed(m_index_within_job);
 		return;
 	}
+	// the hash of a resumed file has to cover the part we already had
+	m_sink.begin(&m_output_file, resume);
 
 	auto worker = MMC->qnam();
 	QNetworkReply *rep = worker->get(request);
@@ -89,14 +122,17 @@ void MD5EtagDownload::start()
 	m_reply = std::shared_ptr<QNetworkReply>(rep);
 	connect(rep, SIGNAL(downloadProgress(qint64, qint64)),
 			SLOT(downloadProgress(qint64, qint64)));
-	connect(rep, SIGNAL(finished()), SLOT(downloadFinished()));
 	connect(rep, SIGNAL(error(QNetworkReply::NetworkError)),
 			SLOT(downloadError(QNetworkReply::NetworkError)));
-	connect(rep, SIGNAL(readyRead()), SLOT(downloadReadyRead()));
+	meterReply(rep);
 }
 
 void MD5EtagDownload::downloadProgress(qint64 bytesReceived, qint64 bytesTotal)
 {
+	// when resuming, the reply only knows about the remaining part
+	if (bytesTotal >= 0)
+		bytesTotal += m_resume_offset;
+	bytesReceived += m_resume_offset;
 	m_total_progress = bytesTotal;
 	m_progress = bytesReceived;
 	emit progress(m_index_within_job, bytesReceived, bytesTotal);
@@ -111,12 +147,58 @@ void MD5EtagDownload::downloadError(QNetworkReply::NetworkError error)
 
 void MD5EtagDownload::downloadFinished()
 {
+	if (!m_sink.finish())
+		m_status = Job_Failed;
+	m_output_file.close();
 	// if the download succeeded
 	if (m_status != Job_Failed)
 	{
+		// not modified, the file we have is fine
+		if (httpStatus() == 304)
+		{
+			QFile::remove(m_output_file.fileName());
+			m_resume_validator.clear();
+			m_status = Job_Finished;
+			m_reply.reset();
+			emit succeeded(m_index_within_job);
+			return;
+		}
+
+		// resumed data is only as good as the server's word. check it if we can.
+		if (m_resume_offset)
+		{
+			QString expected = m_expected_md5;
+			if (expected.isEmpty())
+				expected = md5FromEtag(m_reply->rawHeader("ETag"));
+			if (!expected.isEmpty())
+			{
+				if (m_sink.result().toHex().constData() != expected)
+				{
+					QLOG_ERROR() << "Resumed download of " << m_url.toString()
+								 << " doesn't match the expected MD5, starting over.";
+					QFile::remove(m_output_file.fileName());
+					m_resume_validator.clear();
+					m_status = Job_Failed;
+					m_reply.reset();
+					emit failed(m_index_within_job);
+					return;
+				}
+			}
+		}
+
 		// nothing went wrong...
+		m_resume_validator.clear();
+		if (!replaceFile(m_output_file.fileName(), m_target_path))
+		{
+			QLOG_ERROR() << "Failed to move " << m_output_file.fileName() << " to "
+						 << m_target_path;
+			QFile::remove(m_output_file.fileName());
+			m_status = Job_Failed;
+			m_reply.reset();
+			emit failed(m_index_within_job);
+			return;
+		}
 		m_status = Job_Finished;
-		m_output_file.close();
 
 		// FIXME: compare with the real written data md5sum
 		// this is just an ETag
@@ -129,8 +211,19 @@ void MD5EtagDownload::downloadFinished()
 	// else the download failed
 	else
 	{
-		m_output_file.close();
-		m_output_file.remove();
+		// keep what we got for the next attempt, if the server told us enough to resume it
+		QByteArray validator = resumeValidator();
+		if (!validator.isEmpty() && m_output_file.size())
+		{
+			m_resume_validator = validator;
+			QLOG_INFO() << "Keeping " << m_output_file.size() << " bytes of "
+						<< m_url.toString() << " for resuming.";
+		}
+		else
+		{
+			m_resume_validator.clear();
+			m_output_file.remove();
+		}
 		m_reply.reset();
 		emit failed(m_index_within_job);
 		return;
@@ -146,10 +239,28 @@ void MD5EtagDownload::downloadReadyRead()
 			/*
 			* Can't open the file... the job failed
 			*/
+			m_status = Job_Failed;
 			m_reply->abort();
 			emit failed(m_index_within_job);
 			return;
 		}
+		m_sink.begin(&m_output_file);
+	}
+	if (!m_checked_response)
+	{
+		m_checked_response = true;
+		if (m_resume_offset && httpStatus() != 206)
+		{
+			// the server can't do ranges or the file changed since. start from scratch.
+			QLOG_INFO() << "Server refused to resume " << m_url.toString()
+						<< ", downloading the whole file.";
+			m_sink.restart();
+			m_resume_offset = 0;
+		}
+	}
+	if (!m_sink.readFrom(m_reply.get()))
+	{
+		m_status = Job_Failed;
+		m_reply->abort();
 	}
-	m_output_file.write(m_reply->readAll());
 }
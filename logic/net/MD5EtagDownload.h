@@ -16,6 +16,7 @@
 #pragma once
 
 #include "NetAction.h"
+#include "DownloadSink.h"
 #include <QFile>
 
 typedef std::shared_ptr<class MD5EtagDownload> Md5EtagDownloadPtr;
@@ -29,9 +30,19 @@ public:
 	QString m_local_md5;
 	/// if saving to file, use the one specified in this string
 	QString m_target_path;
-	/// this is the output file, if any
+	/// data is downloaded into this file and moved to the target path when complete
 	QFile m_output_file;
 
+private:
+	/// ETag or Last-Modified of the response the partial data came from. empty if there's none.
+	QByteArray m_resume_validator;
+	/// how many bytes we already had when the current request was made
+	qint64 m_resume_offset = 0;
+	/// true once the status of the current response has been looked at
+	bool m_checked_response = false;
+	/// writes and hashes the data as it arrives
+	DownloadSink m_sink;
+
 public:
 	explicit MD5EtagDownload(QUrl url, QString target_path);
 	static Md5EtagDownloadPtr make(QUrl url, QString target_path)
@@ -0,0 +1,157 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "NetAction.h"
+#include "BandwidthBudget.h"
+
+#include <QDateTime>
+
+// how much a reply buffers before Qt stops reading its socket
+static const qint64 meteredBufferSize = 64 * 1024;
+
+NetAction::NetAction() : QObject(0)
+{
+	// connected first, so the attempt is closed before the job hears about it
+	connect(this, SIGNAL(succeeded(int)), SLOT(attemptEnded()));
+	connect(this, SIGNAL(failed(int)), SLOT(attemptEnded()));
+}
+
+qint64 NetAction::attemptTime() const
+{
+	return QDateTime::currentMSecsSinceEpoch() - m_timing.attempt_started_at;
+}
+
+void NetAction::meterReply(QNetworkReply *reply)
+{
+	// a new request before the action finished is a redirect (or similar restart)
+	if (m_attempt_open)
+	{
+		m_timing.redirects++;
+	}
+	else
+	{
+		m_attempt_open = true;
+		qint64 now = QDateTime::currentMSecsSinceEpoch();
+		if (!m_timing.attempts)
+			m_timing.started_at = now;
+		m_timing.attempt_started_at = now;
+		m_timing.attempt_bytes = 0;
+		m_timing.redirects = 0;
+		m_timing.attempts++;
+	}
+	m_timing.encrypted = -1;
+	m_timing.headers = -1;
+	m_timing.first_byte = -1;
+	m_timing.transfer = -1;
+	connect(reply, SIGNAL(encrypted()), SLOT(timingEncrypted()));
+	connect(reply, SIGNAL(metaDataChanged()), SLOT(timingHeaders()));
+
+	m_finish_pending = false;
+	reply->setReadBufferSize(meteredBufferSize);
+	connect(reply, SIGNAL(readyRead()), SLOT(meteredReadyRead()));
+	connect(reply, SIGNAL(finished()), SLOT(meteredFinished()));
+}
+
+bool NetAction::readMetered()
+{
+	if (!m_reply)
+		return true;
+	qint64 available = m_reply->bytesAvailable();
+	if (!available)
+		return true;
+	auto budget = MMC->bandwidthBudget();
+	if (!budget->mayRead(m_priority))
+	{
+		connect(budget.get(), SIGNAL(budgetAvailable()), this, SLOT(budgetAvailable()),
+				Qt::UniqueConnection);
+		return false;
+	}
+	if (m_timing.first_byte < 0)
+		m_timing.first_byte = attemptTime();
+	downloadReadyRead();
+	// a download sink may not have taken everything. it calls readMore when it has room.
+	qint64 left = m_reply ? m_reply->bytesAvailable() : 0;
+	m_timing.bytes += available - left;
+	m_timing.attempt_bytes += available - left;
+	budget->consume(m_priority, available - left);
+	return left == 0 || m_status == Job_Failed;
+}
+
+void NetAction::finishMetered()
+{
+	// set before the implementation reports the result. a redirect resets it.
+	m_timing.transfer = attemptTime();
+	m_timing.http_status = httpStatus();
+	downloadFinished();
+}
+
+void NetAction::timingEncrypted()
+{
+	m_timing.encrypted = attemptTime();
+}
+
+void NetAction::timingHeaders()
+{
+	if (m_timing.headers < 0)
+		m_timing.headers = attemptTime();
+}
+
+void NetAction::attemptEnded()
+{
+	m_attempt_open = false;
+}
+
+void NetAction::meteredReadyRead()
+{
+	if (m_finish_pending)
+		return;
+	readMetered();
+}
+
+void NetAction::meteredFinished()
+{
+	// the last of the data has to go through the budget too
+	if (!readMetered())
+	{
+		m_finish_pending = true;
+		return;
+	}
+	finishMetered();
+}
+
+void NetAction::readMore()
+{
+	if (!readMetered())
+		return;
+	if (m_finish_pending)
+	{
+		m_finish_pending = false;
+		finishMetered();
+	}
+}
+
+void NetAction::budgetAvailable()
+{
+	if (!readMetered())
+		return;
+	disconnect(MMC->bandwidthBudget().get(), SIGNAL(budgetAvailable()), this,
+			   SLOT(budgetAvailable()));
+	if (m_finish_pending)
+	{
+		m_finish_pending = false;
+		finishMetered();
+	}
+}
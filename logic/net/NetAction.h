@@ -19,6 +19,7 @@
 #include <QUrl>
 #include <memory>
 #include <QNetworkReply>
+#include <cctype>
 
 enum JobStatus
 {
@@ -28,12 +29,50 @@ enum JobStatus
 	Job_Failed
 };
 
+/// How urgent a download is. Higher priorities get the bandwidth first.
+enum NetPriority
+{
+	Priority_Background,
+	Priority_Normal,
+	Priority_Critical,
+	Priority_Count
+};
+
+/**
+ * Timing of a network action, for the network statistics.
+ * Times within an attempt are in ms since the attempt started, -1 if they didn't happen.
+ */
+struct NetActionTiming
+{
+	/// ms spent waiting in the job's queue, including retry backoff
+	qint64 queue_wait = 0;
+	/// when the first and the current attempt started, ms since epoch
+	qint64 started_at = 0;
+	qint64 attempt_started_at = 0;
+	/// TLS handshake done
+	qint64 encrypted = -1;
+	/// response headers received. includes DNS, connecting and the server's think time
+	qint64 headers = -1;
+	/// first byte of the body read
+	qint64 first_byte = -1;
+	/// attempt finished
+	qint64 transfer = -1;
+	/// bytes received over all attempts, and in the current one
+	qint64 bytes = 0;
+	qint64 attempt_bytes = 0;
+	int attempts = 0;
+	/// redirects followed in the current attempt
+	int redirects = 0;
+	/// HTTP status of the last response
+	int http_status = 0;
+};
+
 typedef std::shared_ptr<class NetAction> NetActionPtr;
 class NetAction : public QObject, public std::enable_shared_from_this<NetAction>
 {
 	Q_OBJECT
 protected:
-	explicit NetAction() : QObject(0) {};
+	explicit NetAction();
 
 public:
 	virtual ~NetAction() {};
@@ -56,6 +95,33 @@ public:
 		return shared_from_this();
 	}
 
+	/**
+	 * Called by the DownloadCoordinator when the identical download this action was attached
+	 * to has finished successfully. Implementations should pick up the result.
+	 */
+	virtual void attachedSucceeded(NetAction *leader)
+	{
+		m_status = Job_Finished;
+		emit succeeded(m_index_within_job);
+	}
+
+	/**
+	 * Try to get the data from somewhere else, because the current host is unavailable.
+	 * Returns true if the URL was changed.
+	 */
+	virtual bool switchSource()
+	{
+		return false;
+	}
+
+	/// Called by the DownloadCoordinator when the download this was attached to has failed.
+	/// The leader is null if it went away without finishing.
+	virtual void attachedFailed(NetAction *leader)
+	{
+		m_status = Job_Failed;
+		emit failed(m_index_within_job);
+	}
+
 public:
 	/// the network reply
 	std::shared_ptr<QNetworkReply> m_reply;
@@ -78,14 +144,86 @@ public:
 	/// number of failures up to this point
 	int m_failures = 0;
 
+	/// priority of the job this runs in, for the bandwidth budget
+	NetPriority m_priority = Priority_Normal;
+
+	/// timing of the requests made through meterReply
+	NetActionTiming m_timing;
+
 signals:
 	void started(int index);
 	void progress(int index, qint64 current, qint64 total);
 	void succeeded(int index);
 	void failed(int index);
+	/// attached to an identical download by the DownloadCoordinator. No network is used
+	/// until that one is done.
+	void attached(int index);
+
+protected:
+	/**
+	 * Route the reply's readyRead and finished signals through the bandwidth budget.
+	 * Use instead of connecting them to downloadReadyRead and downloadFinished directly.
+	 */
+	void meterReply(QNetworkReply *reply);
+
+	/// HTTP status code of the current reply, or 0 if there isn't one
+	int httpStatus() const
+	{
+		if (!m_reply)
+			return 0;
+		return m_reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+	}
+
+	/**
+	 * Something that identifies the entity in the current reply, for resuming it later with
+	 * If-Range. Only strong ETags are usable, Last-Modified is the fallback.
+	 */
+	QByteArray resumeValidator() const
+	{
+		if (!m_reply)
+			return QByteArray();
+		int status = httpStatus();
+		if (status != 200 && status != 206)
+			return QByteArray();
+		QByteArray etag = m_reply->rawHeader("ETag");
+		if (!etag.isEmpty() && !etag.startsWith("W/"))
+			return etag;
+		return m_reply->rawHeader("Last-Modified");
+	}
+
+	/// If the ETag is a plain MD5 sum (as served by S3), return it in hex. Otherwise empty.
+	static QString md5FromEtag(QByteArray etag)
+	{
+		etag = etag.trimmed();
+		if (etag.startsWith('"') && etag.endsWith('"') && etag.size() >= 2)
+			etag = etag.mid(1, etag.size() - 2);
+		if (etag.size() != 32)
+			return QString();
+		for (char c : etag)
+		{
+			if (!isxdigit((unsigned char)c))
+				return QString();
+		}
+		return QString::fromLatin1(etag.toLower());
+	}
 
 protected
 slots:
+	/// progress of the download this was attached to by the DownloadCoordinator
+	void attachedProgress(int, qint64 current, qint64 total)
+	{
+		m_progress = current;
+		m_total_progress = total;
+		emit progress(m_index_within_job, current, total);
+	}
+	void meteredReadyRead();
+	void meteredFinished();
+	void budgetAvailable();
+	/// there's room for more data. for download sinks that couldn't take everything
+	void readMore();
+	void timingEncrypted();
+	void timingHeaders();
+	void attemptEnded();
 	virtual void downloadProgress(qint64 bytesReceived, qint64 bytesTotal) = 0;
 	virtual void downloadError(QNetworkReply::NetworkError error) = 0;
 	virtual void downloadFinished() = 0;
@@ -94,4 +232,17 @@ slots:
 public
 slots:
 	virtual void start() = 0;
+
+private:
+	/// read what the reply has, if the budget allows it. false if some of it is left
+	bool readMetered();
+	/// pass the end of the reply on to the implementation
+	void finishMetered();
+	qint64 attemptTime() const;
+
+private:
+	/// the reply finished, but still holds data we didn't have the budget or room for
+	bool m_finish_pending = false;
+	/// a request was made and the action didn't succeed or fail yet
+	bool m_attempt_open = false;
 };
@@ -19,9 +19,45 @@
 #include "MD5EtagDownload.h"
 #include "ByteArrayDownload.h"
 #include "CacheDownload.h"
+#include "HostScheduler.h"
+#include "BandwidthBudget.h"
 
 #include "logger/QsLog.h"
 
+#include <QDateTime>
+#include <random>
+
+// delay before the first retry of a failed part. doubles with every further failure
+static const qint64 retryBaseDelay = 1000;
+static const qint64 retryMaxDelay = 30000;
+
+NetJob::NetJob(QString job_name) : ProgressProvider(), m_job_name(job_name)
+{
+	connect(MMC->hostScheduler().get(), SIGNAL(slotsAvailable()), SLOT(hostSlotsAvailable()),
+			Qt::QueuedConnection);
+	connect(MMC->bandwidthBudget().get(), SIGNAL(preemptionChanged()),
+			SLOT(hostSlotsAvailable()), Qt::QueuedConnection);
+	m_retryTimer.setSingleShot(true);
+	connect(&m_retryTimer, SIGNAL(timeout()), SLOT(retryTimeout()));
+	connect(&m_progress, SIGNAL(progress(qint64, qint64)), SIGNAL(progress(qint64, qint64)));
+}
+
+NetJob::~NetJob()
+{
+	if (m_running)
+		setRunning(false);
+	// hand back the host slots of anything still running
+	auto scheduler = MMC->hostScheduler();
+	if (!scheduler)
+		return;
+	for (auto index : m_doing)
+	{
+		auto &slot = parts_progress[index];
+		if (slot.holds_slot)
+			scheduler->release(slot.host, true, slot.generation);
+	}
+}
+
 void NetJob::partSucceeded(int index)
 {
 	// do progress. all slots are 1 in size at least
@@ -31,6 +67,9 @@ void NetJob::partSucceeded(int index)
 	m_doing.remove(index);
 	m_done.insert(index);
 	disconnect(downloads[index].get(), 0, this, 0);
+	releaseSlot(index, true);
+	m_stats.add(downloads[index]->m_timing, true);
+	MMC->netStats()->record(m_job_name, downloads[index].get(), true);
 	startMoreParts();
 }
 
@@ -38,16 +77,81 @@ void NetJob::partFailed(int index)
 {
 	m_doing.remove(index);
 	auto &slot = parts_progress[index];
+	disconnect(downloads[index].get(), 0, this, 0);
+	releaseSlot(index, false);
 	if (slot.failures == 3)
 	{
 		m_failed.insert(index);
+		m_stats.add(downloads[index]->m_timing, false);
+		MMC->netStats()->record(m_job_name, downloads[index].get(), false);
 	}
 	else
 	{
 		slot.failures++;
-		m_todo.enqueue(index);
+		// moved on to another host (a different mirror), no reason to wait
+		if (downloads[index]->m_url.host() != slot.host)
+			enqueue(index);
+		else
+			retryLater(index, slot.failures);
 	}
-	disconnect(downloads[index].get(), 0, this, 0);
+	startMoreParts();
+}
+
+void NetJob::partAttached(int index)
+{
+	// the part waits for someone else's download. others can have its slot in the meantime
+	auto &slot = parts_progress[index];
+	if (!slot.holds_slot)
+		return;
+	slot.holds_slot = false;
+	MMC->hostScheduler()->cancel(slot.host);
+}
+
+void NetJob::releaseSlot(int index, bool success)
+{
+	auto &slot = parts_progress[index];
+	if (!slot.holds_slot)
+		return;
+	slot.holds_slot = false;
+	MMC->hostScheduler()->release(slot.host, success, slot.generation);
+}
+
+void NetJob::retryLater(int index, int failures)
+{
+	// exponential backoff, with jitter so the retries don't all arrive at once
+	static std::mt19937 rng(std::random_device{}());
+	qint64 delay = qMin(retryMaxDelay, retryBaseDelay << (failures - 1));
+	std::uniform_int_distribution<qint64> jitter(delay / 2, delay);
+	delay = jitter(rng);
+	QLOG_INFO() << "Retrying" << downloads[index]->m_url.toString() << "in" << delay << "ms";
+	qint64 now = QDateTime::currentMSecsSinceEpoch();
+	parts_progress[index].queued_at = now;
+	m_backoff.insert(now + delay, index);
+	scheduleRetry();
+}
+
+void NetJob::scheduleRetry()
+{
+	if (m_backoff.isEmpty())
+	{
+		m_retryTimer.stop();
+		return;
+	}
+	qint64 wait = m_backoff.firstKey() - QDateTime::currentMSecsSinceEpoch();
+	m_retryTimer.start(int(qMax<qint64>(0, wait)));
+}
+
+void NetJob::retryTimeout()
+{
+	qint64 now = QDateTime::currentMSecsSinceEpoch();
+	while (!m_backoff.isEmpty() && m_backoff.firstKey() <= now)
+	{
+		auto first = m_backoff.begin();
+		// queued_at was set when the retry was scheduled, the wait counts as queueing
+		m_todo.enqueue(first.value());
+		m_backoff.erase(first);
+	}
+	scheduleRetry();
 	startMoreParts();
 }
 
@@ -55,6 +159,10 @@ void NetJob::partProgress(int index, qint64 bytesReceived, qint64 bytesTotal)
 {
 	auto &slot = parts_progress[index];
 
+	// progress of an attached part is what some other part already reported
+	if (slot.holds_slot && bytesReceived > slot.current_progress)
+		MMC->hostScheduler()->reportBytes(slot.host, bytesReceived - slot.current_progress);
+
 	current_progress -= slot.current_progress;
 	slot.current_progress = bytesReceived;
 	current_progress += slot.current_progress;
@@ -62,57 +170,154 @@ void NetJob::partProgress(int index, qint64 bytesReceived, qint64 bytesTotal)
 	total_progress -= slot.total_progress;
 	slot.total_progress = bytesTotal;
 	total_progress += slot.total_progress;
-	emit progress(current_progress, total_progress);
+	m_progress.setProgress(current_progress, total_progress);
 }
 
 void NetJob::start()
 {
 	QLOG_INFO() << m_job_name.toLocal8Bit() << " started.";
-	m_running = true;
+	setRunning(true);
+	m_started_at = QDateTime::currentMSecsSinceEpoch();
 	for (int i = 0; i < downloads.size(); i++)
 	{
-		m_todo.enqueue(i);
+		enqueue(i);
 	}
 	startMoreParts();
 }
 
 void NetJob::startMoreParts()
 {
-	// check for final conditions if there's nothing in the queue
-	if(!m_todo.size())
+	// a part that finishes right away calls back in here. the pass that's running picks it up
+	if (m_starting)
 	{
-		if(!m_doing.size())
+		m_start_again = true;
+		return;
+	}
+	m_starting = true;
+	do
+	{
+		m_start_again = false;
+		startQueuedParts();
+	} while (m_start_again);
+	m_starting = false;
+
+	// check for final conditions if there's nothing left to do
+	if(!m_todo.size() && !m_doing.size() && m_backoff.isEmpty() && !m_expecting_more)
+	{
+		setRunning(false);
+		// the final numbers go out before the result
+		m_progress.flush();
+		MMC->netStats()->jobFinished(m_job_name, m_stats,
+									 QDateTime::currentMSecsSinceEpoch() - m_started_at);
+		if(!m_failed.size())
+		{
+			QLOG_INFO() << m_job_name.toLocal8Bit() << "succeeded.";
+			emit succeeded();
+		}
+		else
+		{
+			QLOG_ERROR() << m_job_name.toLocal8Bit() << "failed.";
+			emit failed();
+		}
+	}
+}
+
+void NetJob::startQueuedParts()
+{
+	// background jobs wait while something more important downloads
+	if (!m_todo.size() || MMC->bandwidthBudget()->isPreempted(m_priority))
+		return;
+	// otherwise try to start more parts, skipping those whose host is at its limit
+	auto scheduler = MMC->hostScheduler();
+	// hosts that didn't have a free slot. their parts are skipped for the rest of the pass
+	QSet<QString> full;
+	int i = 0;
+	while (i < m_todo.size())
+	{
+		int doThis = m_todo[i];
+		auto part = downloads[doThis];
+		QString host = part->m_url.host();
+		if (full.contains(host))
 		{
-			if(!m_failed.size())
+			i++;
+			continue;
+		}
+		int generation = 0;
+		if (!scheduler->tryAcquire(host, &generation))
+		{
+			// the host is paused after too many errors - maybe the part can go elsewhere
+			if (!scheduler->isTripped(host))
 			{
-				QLOG_INFO() << m_job_name.toLocal8Bit() << "succeeded.";
-				emit succeeded();
+				full.insert(host);
+				i++;
+				continue;
 			}
-			else
+			if (!part->switchSource())
 			{
-				QLOG_ERROR() << m_job_name.toLocal8Bit() << "failed.";
-				emit failed();
+				i++;
+				continue;
+			}
+			host = part->m_url.host();
+			if (full.contains(host) || !scheduler->tryAcquire(host, &generation))
+			{
+				full.insert(host);
+				i++;
+				continue;
 			}
 		}
-		return;
-	}
-	// otherwise try to start more parts
-	while (m_doing.size() < 6)
-	{
-		if(!m_todo.size())
-			return;
-		int doThis = m_todo.dequeue();
+		// only this loop takes parts out of the queue, so i now points at the next one
+		m_todo.removeAt(i);
 		m_doing.insert(doThis);
-		auto part = downloads[doThis];
+		parts_progress[doThis].host = host;
+		parts_progress[doThis].holds_slot = true;
+		parts_progress[doThis].generation = generation;
+		part->m_priority = m_priority;
+		part->m_timing.queue_wait +=
+			QDateTime::currentMSecsSinceEpoch() - parts_progress[doThis].queued_at;
 		// connect signals :D
 		connect(part.get(), SIGNAL(succeeded(int)), SLOT(partSucceeded(int)));
 		connect(part.get(), SIGNAL(failed(int)), SLOT(partFailed(int)));
+		connect(part.get(), SIGNAL(attached(int)), SLOT(partAttached(int)));
 		connect(part.get(), SIGNAL(progress(int, qint64, qint64)),
 				SLOT(partProgress(int, qint64, qint64)));
 		part->start();
 	}
 }
 
+void NetJob::setExpectingMore(bool expecting)
+{
+	m_expecting_more = expecting;
+	// everything may be done already
+	if (!expecting && m_running)
+		startMoreParts();
+}
+
+void NetJob::enqueue(int index)
+{
+	parts_progress[index].queued_at = QDateTime::currentMSecsSinceEpoch();
+	m_todo.enqueue(index);
+}
+
+void NetJob::setRunning(bool running)
+{
+	if (m_running == running)
+		return;
+	m_running = running;
+	auto budget = MMC->bandwidthBudget();
+	if (!budget)
+		return;
+	if (running)
+		budget->jobStarted(m_priority);
+	else
+		budget->jobFinished(m_priority);
+}
+
+void NetJob::hostSlotsAvailable()
+{
+	if (!m_running || !m_todo.size())
+		return;
+	startMoreParts();
+}
 
 QStringList NetJob::getFailedFiles()
 {
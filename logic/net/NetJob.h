@@ -16,12 +16,15 @@
 #pragma once
 #include <QtNetwork>
 #include <QLabel>
+#include <QTimer>
 #include "NetAction.h"
 #include "ByteArrayDownload.h"
 #include "MD5EtagDownload.h"
 #include "CacheDownload.h"
 #include "HttpMetaCache.h"
+#include "NetStats.h"
 #include "logic/tasks/ProgressProvider.h"
+#include "logic/tasks/ProgressAggregator.h"
 #include "logic/QObjectPtr.h"
 
 class NetJob;
@@ -31,8 +34,8 @@ class NetJob : public ProgressProvider
 {
 	Q_OBJECT
 public:
-	explicit NetJob(QString job_name) : ProgressProvider(), m_job_name(job_name) {}
-	virtual ~NetJob() {}
+	explicit NetJob(QString job_name);
+	virtual ~NetJob();
 	template <typename T> bool addNetAction(T action)
 	{
 		NetActionPtr base = std::static_pointer_cast<NetAction>(action);
@@ -46,15 +49,12 @@ public:
 		}
 		parts_progress.append(pi);
 		total_progress += pi.total_progress;
-		// if this is already running, the action needs to be started right away!
+		// if this is already running, the action needs to be scheduled right away!
 		if (isRunning())
 		{
-			emit progress(current_progress, total_progress);
-			connect(base.get(), SIGNAL(succeeded(int)), SLOT(partSucceeded(int)));
-			connect(base.get(), SIGNAL(failed(int)), SLOT(partFailed(int)));
-			connect(base.get(), SIGNAL(progress(int, qint64, qint64)),
-					SLOT(partProgress(int, qint64, qint64)));
-			base->start();
+			m_progress.setProgress(current_progress, total_progress);
+			enqueue(base->m_index_within_job);
+			startMoreParts();
 		}
 		return true;
 	}
@@ -83,8 +83,30 @@ public:
 	}
 	QStringList getFailedFiles();
 
+	/// Background jobs give way to launch-critical ones. Set before starting the job.
+	void setPriority(NetPriority priority)
+	{
+		m_priority = priority;
+	}
+	NetPriority priority() const
+	{
+		return m_priority;
+	}
+
+	/// Keep running when the job runs out of parts, because more will be added.
+	/// The job finishes once this is cleared again and the last part is done.
+	void setExpectingMore(bool expecting);
+
 private:
 	void startMoreParts();
+	/// one pass over the queue, starting what the hosts have room for
+	void startQueuedParts();
+	void enqueue(int index);
+	void setRunning(bool running);
+	/// give back the part's request slot, if it still has it
+	void releaseSlot(int index, bool success);
+	void retryLater(int index, int failures);
+	void scheduleRetry();
 
 signals:
 	void started();
@@ -101,6 +123,9 @@ private slots:
 	void partProgress(int index, qint64 bytesReceived, qint64 bytesTotal);
 	void partSucceeded(int index);
 	void partFailed(int index);
+	void partAttached(int index);
+	void hostSlotsAvailable();
+	void retryTimeout();
 
 private:
 	struct part_info
@@ -108,6 +133,14 @@ private:
 		qint64 current_progress = 0;
 		qint64 total_progress = 1;
 		int failures = 0;
+		/// host the part was started against, for the host scheduler
+		QString host;
+		/// the part still has the request slot it was started with
+		bool holds_slot = false;
+		/// breaker generation of the host when the slot was taken
+		int generation = 0;
+		/// when the part was put in the queue, ms since epoch
+		qint64 queued_at = 0;
 	};
 	QString m_job_name;
 	QList<NetActionPtr> downloads;
@@ -116,7 +149,20 @@ private:
 	QSet<int> m_doing;
 	QSet<int> m_done;
 	QSet<int> m_failed;
+	/// failed parts waiting to be retried, by the time they're due (ms since epoch)
+	QMultiMap<qint64, int> m_backoff;
+	QTimer m_retryTimer;
 	qint64 current_progress = 0;
 	qint64 total_progress = 0;
+	/// the parts report every chunk, this passes it on at a sane rate
+	ProgressAggregator m_progress;
 	bool m_running = false;
+	NetPriority m_priority = Priority_Normal;
+	bool m_expecting_more = false;
+	/// startMoreParts is running, and was called again in the meantime
+	bool m_starting = false;
+	bool m_start_again = false;
+	/// timings of the finished parts
+	NetRollup m_stats;
+	qint64 m_started_at = 0;
 };
@@ -0,0 +1,165 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "NetStats.h"
+#include "logic/settings/SettingsObject.h"
+#include "logger/QsLog.h"
+
+#include <QJsonDocument>
+#include <QSaveFile>
+
+// requests kept for the dump, the oldest are dropped first
+static const int maxDumpedRequests = 10000;
+// the dump waits this long after a job, so a burst of jobs is written once
+static const int dumpDelay = 5000;
+
+static double rate(qint64 bytes, qint64 ms)
+{
+	if (ms <= 0)
+		return 0;
+	return double(bytes) * 1000.0 / double(ms);
+}
+
+void NetRollup::add(const NetActionTiming &timing, bool ok)
+{
+	requests++;
+	if (!ok)
+		failures++;
+	retries += qMax(0, timing.attempts - 1);
+	redirects += timing.redirects;
+	bytes += timing.bytes;
+	queue_wait += timing.queue_wait;
+	if (timing.headers >= 0)
+	{
+		headers += timing.headers;
+		with_headers++;
+	}
+	if (timing.first_byte >= 0)
+	{
+		first_byte += timing.first_byte;
+		with_first_byte++;
+	}
+	if (timing.transfer >= 0)
+		transfer += timing.transfer;
+}
+
+QJsonObject NetRollup::toJson() const
+{
+	QJsonObject obj;
+	obj.insert("requests", requests);
+	obj.insert("failures", failures);
+	obj.insert("retries", retries);
+	obj.insert("redirects", redirects);
+	obj.insert("bytes", double(bytes));
+	if (requests)
+		obj.insert("avg_queue_ms", double(queue_wait) / requests);
+	if (with_headers)
+		obj.insert("avg_headers_ms", double(headers) / with_headers);
+	if (with_first_byte)
+		obj.insert("avg_first_byte_ms", double(first_byte) / with_first_byte);
+	obj.insert("transfer_ms", double(transfer));
+	obj.insert("bytes_per_s", rate(bytes, transfer));
+	return obj;
+}
+
+NetStats::NetStats(QObject *parent) : QObject(parent)
+{
+	m_dumpTimer.setSingleShot(true);
+	m_dumpTimer.setInterval(dumpDelay);
+	connect(&m_dumpTimer, SIGNAL(timeout()), SLOT(dump()));
+}
+
+NetStats::~NetStats()
+{
+	// whatever the timer didn't get to yet
+	if (m_dirty)
+		dump();
+}
+
+void NetStats::record(const QString &job, NetAction *action, bool ok)
+{
+	auto &timing = action->m_timing;
+	// nothing was requested (cached file, or waited for another job)
+	if (!timing.attempts)
+		return;
+
+	QString host = action->m_url.host();
+	m_hosts[host].add(timing, ok);
+
+	QJsonObject obj;
+	obj.insert("job", job);
+	obj.insert("url", action->m_url.toString());
+	obj.insert("host", host);
+	obj.insert("result", ok ? "ok" : "failed");
+	obj.insert("http", timing.http_status);
+	obj.insert("queue_ms", double(timing.queue_wait));
+	obj.insert("tls_ms", double(timing.encrypted));
+	obj.insert("headers_ms", double(timing.headers));
+	obj.insert("first_byte_ms", double(timing.first_byte));
+	obj.insert("transfer_ms", double(timing.transfer));
+	obj.insert("bytes", double(timing.bytes));
+	obj.insert("bytes_per_s", rate(timing.attempt_bytes, timing.transfer));
+	obj.insert("retries", timing.attempts - 1);
+	obj.insert("redirects", timing.redirects);
+	QLOG_INFO() << "NetTiming" << QJsonDocument(obj).toJson(QJsonDocument::Compact).constData();
+
+	m_requests.append(obj);
+	while (m_requests.size() > maxDumpedRequests)
+		m_requests.removeFirst();
+}
+
+void NetStats::jobFinished(const QString &job, const NetRollup &rollup, qint64 duration)
+{
+	if (!rollup.requests)
+		return;
+	QJsonObject obj = rollup.toJson();
+	obj.insert("job", job);
+	obj.insert("duration_ms", double(duration));
+	QLOG_INFO() << "NetTimingJob"
+				<< QJsonDocument(obj).toJson(QJsonDocument::Compact).constData();
+	m_jobs.append(obj);
+
+	if (MMC->settings()->get("NetTimingDump").toBool())
+	{
+		m_dirty = true;
+		if (!m_dumpTimer.isActive())
+			m_dumpTimer.start();
+	}
+}
+
+void NetStats::dump()
+{
+	m_dumpTimer.stop();
+	m_dirty = false;
+	QJsonObject hosts;
+	for (auto iter = m_hosts.begin(); iter != m_hosts.end(); ++iter)
+	{
+		hosts.insert(iter.key(), iter.value().toJson());
+	}
+	QJsonObject root;
+	root.insert("jobs", m_jobs);
+	root.insert("hosts", hosts);
+	root.insert("requests", m_requests);
+
+	QSaveFile file("net-timing.json");
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		QLOG_ERROR() << "Couldn't write the network timings to" << file.fileName();
+		return;
+	}
+	file.write(QJsonDocument(root).toJson());
+	file.commit();
+}
@@ -0,0 +1,82 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QMap>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QTimer>
+
+#include "NetAction.h"
+
+/// Sums of the timings of many network actions, for a job or a host
+struct NetRollup
+{
+	int requests = 0;
+	int failures = 0;
+	int retries = 0;
+	int redirects = 0;
+	qint64 bytes = 0;
+	/// sums in ms, divided by the number of requests that have them for the averages
+	qint64 queue_wait = 0;
+	qint64 headers = 0;
+	int with_headers = 0;
+	qint64 first_byte = 0;
+	int with_first_byte = 0;
+	qint64 transfer = 0;
+
+	void add(const NetActionTiming &timing, bool ok);
+	QJsonObject toJson() const;
+};
+
+/**
+ * Collects the timings of all network actions and writes them to the log, as one JSON object
+ * per line starting with "NetTiming". The jobs and hosts are rolled up too.
+ *
+ * With the NetTimingDump setting on, everything is also written to net-timing.json in the
+ * data folder. The file is rewritten at most every few seconds after a job, and on exit.
+ */
+class NetStats : public QObject
+{
+	Q_OBJECT
+public:
+	explicit NetStats(QObject *parent = 0);
+	virtual ~NetStats();
+
+	/// a part of a job succeeded or failed for good
+	void record(const QString &job, NetAction *action, bool ok);
+	/// a job is done. rollup contains all its parts.
+	void jobFinished(const QString &job, const NetRollup &rollup, qint64 duration);
+
+	QMap<QString, NetRollup> hosts() const
+	{
+		return m_hosts;
+	}
+
+private
+slots:
+	void dump();
+
+private:
+	QMap<QString, NetRollup> m_hosts;
+	QJsonArray m_jobs;
+	QJsonArray m_requests;
+	/// something changed since the last dump
+	bool m_dirty = false;
+	QTimer m_dumpTimer;
+};
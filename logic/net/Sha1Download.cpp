@@ -0,0 +1,150 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiMC.h"
+#include "Sha1Download.h"
+#include "DownloadCoordinator.h"
+#include <pathutils.h>
+#include "logger/QsLog.h"
+
+Sha1Download::Sha1Download(QUrl url, QString target_path, QString expected_sha1)
+	: NetAction(), m_sink(QCryptographicHash::Sha1)
+{
+	m_url = url;
+	m_target_path = target_path;
+	m_expected_sha1 = expected_sha1.toLower();
+	m_status = Job_NotStarted;
+	connect(&m_sink, SIGNAL(bufferFreed()), SLOT(readMore()));
+}
+
+void Sha1Download::start()
+{
+	m_status = Job_InProgress;
+	// if another job is already downloading this file, wait for it instead
+	if (!MMC->downloadCoordinator()->claim(getSharedPtr(), m_target_path))
+	{
+		return;
+	}
+	if (!ensureFilePathExists(m_target_path))
+	{
+		QLOG_ERROR() << "Could not create folder for " + m_target_path;
+		m_status = Job_Failed;
+		emit failed(m_index_within_job);
+		return;
+	}
+	m_output_file.setFileName(m_target_path + ".part");
+	if (!m_output_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		QLOG_ERROR() << "Could not open " + m_output_file.fileName() + " for writing";
+		m_status = Job_Failed;
+		emit failed(m_index_within_job);
+		return;
+	}
+	m_sink.begin(&m_output_file);
+
+	QLOG_INFO() << "Downloading " << m_url.toString();
+	QNetworkRequest request(m_url);
+	request.setHeader(QNetworkRequest::UserAgentHeader, "MultiMC/5.0 (Uncached)");
+
+	auto worker = MMC->qnam();
+	QNetworkReply *rep = worker->get(request);
+
+	m_reply = std::shared_ptr<QNetworkReply>(rep);
+	connect(rep, SIGNAL(downloadProgress(qint64, qint64)),
+			SLOT(downloadProgress(qint64, qint64)));
+	connect(rep, SIGNAL(error(QNetworkReply::NetworkError)),
+			SLOT(downloadError(QNetworkReply::NetworkError)));
+	meterReply(rep);
+}
+
+void Sha1Download::downloadProgress(qint64 bytesReceived, qint64 bytesTotal)
+{
+	m_total_progress = bytesTotal;
+	m_progress = bytesReceived;
+	emit progress(m_index_within_job, bytesReceived, bytesTotal);
+}
+
+void Sha1Download::downloadError(QNetworkReply::NetworkError error)
+{
+	QLOG_ERROR() << "Error" << error << ":" << m_reply->errorString() << "while downloading"
+				 << m_reply->url();
+	m_status = Job_Failed;
+}
+
+void Sha1Download::downloadFinished()
+{
+	QVariant redirect = m_reply->header(QNetworkRequest::LocationHeader);
+	if (redirect.isValid())
+	{
+		m_url = QUrl(redirect.toString());
+		QLOG_INFO() << "Following redirect to " << m_url.toString();
+		m_sink.finish();
+		m_output_file.close();
+		start();
+		return;
+	}
+
+	if (!m_sink.finish())
+		m_status = Job_Failed;
+	m_output_file.close();
+	if (m_status == Job_Failed)
+	{
+		m_output_file.remove();
+		m_reply.reset();
+		emit failed(m_index_within_job);
+		return;
+	}
+
+	QString sha1 = m_sink.result().toHex().constData();
+	if (sha1 != m_expected_sha1)
+	{
+		QLOG_ERROR() << "Downloaded " << m_url.toString() << " has SHA-1 " << sha1
+					 << ", expected " << m_expected_sha1;
+		m_output_file.remove();
+		m_status = Job_Failed;
+		m_reply.reset();
+		emit failed(m_index_within_job);
+		return;
+	}
+
+	if (!replaceFile(m_output_file.fileName(), m_target_path))
+	{
+		QLOG_ERROR() << "Failed to move " << m_output_file.fileName() << " to " << m_target_path;
+		m_output_file.remove();
+		m_status = Job_Failed;
+		m_reply.reset();
+		emit failed(m_index_within_job);
+		return;
+	}
+	m_status = Job_Finished;
+	m_reply.reset();
+	emit succeeded(m_index_within_job);
+}
+
+void Sha1Download::downloadReadyRead()
+{
+	// don't hash or write the bodies of redirects
+	int status = httpStatus();
+	if (status >= 300 && status < 400)
+	{
+		m_reply->readAll();
+		return;
+	}
+	if (!m_sink.readFrom(m_reply.get()))
+	{
+		m_status = Job_Failed;
+		m_reply->abort();
+	}
+}
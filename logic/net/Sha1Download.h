@@ -0,0 +1,59 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "NetAction.h"
+#include "DownloadSink.h"
+#include <QFile>
+
+/**
+ * Downloads a file with a known SHA-1 sum, like the asset objects.
+ * The data is hashed as it arrives and only replaces the target file if the sum matches.
+ */
+typedef std::shared_ptr<class Sha1Download> Sha1DownloadPtr;
+class Sha1Download : public NetAction
+{
+	Q_OBJECT
+public:
+	/// the expected sha1 checksum, in hex
+	QString m_expected_sha1;
+	/// the file to save to
+	QString m_target_path;
+	/// data is downloaded into this file and moved to the target path when verified
+	QFile m_output_file;
+
+public:
+	explicit Sha1Download(QUrl url, QString target_path, QString expected_sha1);
+	static Sha1DownloadPtr make(QUrl url, QString target_path, QString expected_sha1)
+	{
+		return Sha1DownloadPtr(new Sha1Download(url, target_path, expected_sha1));
+	}
+	virtual ~Sha1Download(){};
+protected
+slots:
+	virtual void downloadProgress(qint64 bytesReceived, qint64 bytesTotal);
+	virtual void downloadError(QNetworkReply::NetworkError error);
+	virtual void downloadFinished();
+	virtual void downloadReadyRead();
+
+public
+slots:
+	virtual void start();
+
+private:
+	/// writes and hashes the data as it arrives
+	DownloadSink m_sink;
+};
@@ -44,6 +44,7 @@ void StatusChecker::reloadStatus()
 	// QLOG_INFO() << "Reloading status.";
 
 	NetJob* job = new NetJob("Status JSON");
+	job->setPriority(Priority_Background);
 	job->addNetAction(ByteArrayDownload::make(URLConstants::MOJANG_STATUS_URL));
 	QObject::connect(job, &NetJob::succeeded, this, &StatusChecker::statusDownloadFinished);
 	QObject::connect(job, &NetJob::failed, this, &StatusChecker::statusDownloadFailed);
@@ -0,0 +1,103 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ProgressAggregator.h"
+#include "ProgressProvider.h"
+
+#include <cmath>
+
+// time between two updates that are passed on, 20 per second
+static const int frameInterval = 50;
+// time constant of the throughput smoothing, in ms. about the last few seconds count.
+static const double throughputTimeConstant = 3000.0;
+// shortest time the throughput is measured over
+static const qint64 minSampleTime = 200;
+
+ProgressAggregator::ProgressAggregator(QObject *parent) : QObject(parent)
+{
+	m_frameTimer.setInterval(frameInterval);
+	connect(&m_frameTimer, SIGNAL(timeout()), SLOT(frame()));
+}
+
+void ProgressAggregator::watch(ProgressProvider *provider)
+{
+	connect(provider, SIGNAL(progress(qint64, qint64)), SLOT(setProgress(qint64, qint64)));
+}
+
+qint64 ProgressAggregator::secondsLeft() const
+{
+	if (m_throughput <= 0 || m_total <= m_current)
+		return -1;
+	return qint64(std::ceil((m_total - m_current) / m_throughput));
+}
+
+void ProgressAggregator::setProgress(qint64 current, qint64 total)
+{
+	m_current = current;
+	m_total = total;
+	if (m_frameTimer.isActive())
+	{
+		m_dirty = true;
+		return;
+	}
+	publish();
+	m_frameTimer.start();
+}
+
+void ProgressAggregator::flush()
+{
+	m_frameTimer.stop();
+	if (m_dirty)
+		publish();
+}
+
+void ProgressAggregator::frame()
+{
+	// nothing happened for a whole frame, go quiet until the next update
+	if (!m_dirty)
+	{
+		m_frameTimer.stop();
+		return;
+	}
+	publish();
+}
+
+void ProgressAggregator::publish()
+{
+	m_dirty = false;
+
+	if (!m_sampleClock.isValid() || m_current < m_sampleCurrent)
+	{
+		// first update, or something started over
+		m_sampleClock.start();
+		m_sampleCurrent = m_current;
+		m_throughput = 0;
+	}
+	else if (m_sampleClock.elapsed() >= minSampleTime)
+	{
+		qint64 elapsed = m_sampleClock.restart();
+		double sample = (m_current - m_sampleCurrent) * 1000.0 / elapsed;
+		m_sampleCurrent = m_current;
+		// exponential smoothing that doesn't depend on how often we sample
+		double weight = 1.0 - std::exp(-elapsed / throughputTimeConstant);
+		if (m_throughput <= 0)
+			m_throughput = sample;
+		else
+			m_throughput += (sample - m_throughput) * weight;
+	}
+
+	emit progress(m_current, m_total);
+	emit throughputChanged(m_throughput, secondsLeft());
+}
@@ -0,0 +1,84 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+class ProgressProvider;
+
+/**
+ * Turns a flood of progress updates into a steady trickle.
+ *
+ * Updates are only stored when they come in. They are passed on at a fixed rate, and only if
+ * something changed, together with a smoothed throughput and the estimated time left.
+ * The first update after a quiet period is passed on right away.
+ */
+class ProgressAggregator : public QObject
+{
+	Q_OBJECT
+public:
+	explicit ProgressAggregator(QObject *parent = 0);
+	virtual ~ProgressAggregator() {};
+
+	/// follow the progress of a task or job
+	void watch(ProgressProvider *provider);
+
+	qint64 current() const
+	{
+		return m_current;
+	}
+	qint64 total() const
+	{
+		return m_total;
+	}
+	/// smoothed progress per second, 0 if not known yet
+	double throughput() const
+	{
+		return m_throughput;
+	}
+	/// estimated seconds left, -1 if not known
+	qint64 secondsLeft() const;
+
+public
+slots:
+	void setProgress(qint64 current, qint64 total);
+	/// pass on the last update now
+	void flush();
+
+signals:
+	void progress(qint64 current, qint64 total);
+	void throughputChanged(double throughput, qint64 secondsLeft);
+
+private
+slots:
+	void frame();
+
+private:
+	void publish();
+
+private:
+	QTimer m_frameTimer;
+	bool m_dirty = false;
+	qint64 m_current = 0;
+	qint64 m_total = 0;
+
+	/// for the throughput
+	QElapsedTimer m_sampleClock;
+	qint64 m_sampleCurrent = 0;
+	double m_throughput = 0;
+};
@@ -12,6 +12,7 @@ void TranslationDownloader::downloadTranslations()
 {
 	QLOG_DEBUG() << "Downloading Translations Index...";
 	m_index_job.reset(new NetJob("Translations Index"));
+	m_index_job->setPriority(Priority_Background);
 	m_index_task = ByteArrayDownload::make(QUrl("http://files.multimc.org/translations/index"));
 	m_index_job->addNetAction(m_index_task);
 	connect(m_index_job.get(), &NetJob::failed, this, &TranslationDownloader::indexFailed);
@@ -22,6 +23,7 @@ void TranslationDownloader::indexRecieved()
 {
 	QLOG_DEBUG() << "Got translations index!";
 	m_dl_job.reset(new NetJob("Translations"));
+	m_dl_job->setPriority(Priority_Background);
 	QList<QByteArray> lines = m_index_task->m_data.split('\n');
 	for (const auto line : lines)
 	{
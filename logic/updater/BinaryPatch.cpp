@@ -0,0 +1,85 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BinaryPatch.h"
+
+#include <QDataStream>
+
+static const char patchMagic[] = "MMCPATCH";
+static const int patchMagicSize = 8;
+
+namespace BinaryPatch
+{
+bool apply(const QByteArray &old, const QByteArray &patch, QByteArray &result, QString *error)
+{
+	auto fail = [error](QString reason)
+	{
+		if (error)
+			*error = reason;
+		return false;
+	};
+	if (!patch.startsWith(QByteArray(patchMagic, patchMagicSize)))
+		return fail("not a patch");
+	QByteArray body = qUncompress(patch.mid(patchMagicSize));
+	if (body.isEmpty())
+		return fail("can't decompress the patch");
+
+	QDataStream in(body);
+	in.setByteOrder(QDataStream::BigEndian);
+	qint64 newSize;
+	in >> newSize;
+	if (in.status() != QDataStream::Ok || newSize < 0)
+		return fail("bad header");
+	// every byte of the new file comes out of the patch body, so it can't be any bigger
+	if (newSize > body.size())
+		return fail("new size doesn't fit the patch");
+
+	result.resize(newSize);
+	char *out = result.data();
+	const char *oldData = old.constData();
+	qint64 oldPos = 0;
+	qint64 newPos = 0;
+	while (newPos < newSize)
+	{
+		quint32 diffLength, extraLength;
+		qint64 seek;
+		in >> diffLength >> extraLength >> seek;
+		if (in.status() != QDataStream::Ok)
+			return fail("truncated control block");
+		if (newPos + diffLength + extraLength > newSize)
+			return fail("patch runs past the end of the new file");
+		if (oldPos < 0 || oldPos + diffLength > old.size())
+			return fail("patch doesn't fit the old file");
+
+		if (in.readRawData(out + newPos, diffLength) != int(diffLength))
+			return fail("truncated diff data");
+		for (quint32 i = 0; i < diffLength; i++)
+			out[newPos + i] += oldData[oldPos + i];
+		newPos += diffLength;
+		oldPos += diffLength;
+
+		if (in.readRawData(out + newPos, extraLength) != int(extraLength))
+			return fail("truncated extra data");
+		newPos += extraLength;
+		// nowhere to go in the old file that far away
+		if (seek > old.size() || seek < -qint64(old.size()))
+			return fail("seek out of the old file");
+		oldPos += seek;
+	}
+	if (!in.atEnd())
+		return fail("trailing data after the last block");
+	return true;
+}
+}
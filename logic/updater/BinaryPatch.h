@@ -0,0 +1,39 @@
+/* Copyright 2013-2014 MultiMC Contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+
+/**
+ * Binary patches for the updater, in the style of bsdiff.
+ *
+ * A patch starts with the magic "MMCPATCH". The rest is compressed with qCompress (a big endian
+ * 32 bit length, followed by a zlib stream). Uncompressed, it is a big endian 64 bit size of
+ * the new file, followed by blocks of:
+ *
+ *  - 32 bit length of the diff data, 32 bit length of the extra data, 64 bit seek
+ *  - the diff data. Each byte is added to the next byte of the old file.
+ *  - the extra data, copied to the new file as it is
+ *
+ * The seek is added to the position in the old file after the diff data. Blocks follow each
+ * other until the new file is complete.
+ */
+namespace BinaryPatch
+{
+/// apply the patch to the old data. false, with the reason in error, if the patch is bad
+bool apply(const QByteArray &old, const QByteArray &patch, QByteArray &result, QString *error);
+}
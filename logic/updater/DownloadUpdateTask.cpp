@@ -19,12 +19,18 @@
 #include "BuildConfig.h"
 
 #include "logic/updater/UpdateChecker.h"
+#include "logic/updater/BinaryPatch.h"
 #include "logic/net/NetJob.h"
 #include "pathutils.h"
 
 #include <QFile>
 #include <QTemporaryDir>
 #include <QCryptographicHash>
+#include <QtConcurrentRun>
+#include <QtConcurrentMap>
+#include <QMutex>
+#include <QHash>
+#include <QDateTime>
 
 #include <QDomDocument>
 
@@ -37,6 +43,13 @@ DownloadUpdateTask::DownloadUpdateTask(QString repoUrl, int versionId, QObject *
 	m_nVersionId = versionId;
 
 	m_updateFilesDir.setAutoRemove(false);
+
+	QObject::connect(&m_checkWatcher, &QFutureWatcher<FileCheck>::resultReadyAt, this,
+					 &DownloadUpdateTask::fileChecked);
+	QObject::connect(&m_checkWatcher, &QFutureWatcher<FileCheck>::finished, this,
+					 &DownloadUpdateTask::filesChecked);
+	QObject::connect(&m_patchWatcher, &QFutureWatcher<PatchEntryList>::finished, this,
+					 &DownloadUpdateTask::patchesApplied);
 }
 
 void DownloadUpdateTask::executeTask()
@@ -240,6 +253,12 @@ bool DownloadUpdateTask::parseVersionInfo(const QByteArray &data, VersionFileLis
 					FileSource("httpc", sourceObj.value("Url").toString(),
 							   sourceObj.value("CompressionType").toString()));
 			}
+			else if (type == "patch")
+			{
+				file.sources.append(
+					FileSource("patch", sourceObj.value("Url").toString(), "",
+							   sourceObj.value("BaseMD5").toString()));
+			}
 			else
 			{
 				QLOG_WARN() << "Unknown source type" << type << "ignored.";
@@ -254,17 +273,97 @@ bool DownloadUpdateTask::parseVersionInfo(const QByteArray &data, VersionFileLis
 	return true;
 }
 
-void DownloadUpdateTask::processFileLists()
+namespace
 {
-	// Create a network job for downloading files.
-	NetJob *netJob = new NetJob("Update Files");
+struct HashCacheEntry
+{
+	qint64 size;
+	QDateTime modified;
+	QString md5;
+};
+// MD5s of installed files, so checking for updates again doesn't read everything again
+QMutex hashCacheLock;
+QHash<QString, HashCacheEntry> hashCache;
+}
 
-	if (!processFileLists(netJob, m_cVersionFileList, m_nVersionFileList, m_operationList))
+DownloadUpdateTask::FileCheck DownloadUpdateTask::checkInstalledFile(const VersionFileEntry &entry)
+{
+	FileCheck check;
+	QString realEntryPath = PathCombine(MMC->root(), entry.path);
+	QFileInfo entryInfo(realEntryPath);
+	if (!entryInfo.exists())
 	{
-		emitFailed(tr("Failed to process update lists..."));
-		return;
+		check.result = FileCheck::Missing;
+		return check;
+	}
+
+	bool pass = true;
+	if (!entryInfo.isReadable())
+	{
+		QLOG_ERROR() << "File " << realEntryPath << " is not readable.";
+		pass = false;
+	}
+	if (!entryInfo.isWritable())
+	{
+		QLOG_ERROR() << "File " << realEntryPath << " is not writable.";
+		pass = false;
+	}
+	if (pass)
+	{
+		QMutexLocker locker(&hashCacheLock);
+		auto iter = hashCache.find(realEntryPath);
+		if (iter != hashCache.end() && iter->size == entryInfo.size() &&
+			iter->modified == entryInfo.lastModified())
+		{
+			check.md5 = iter->md5;
+		}
+	}
+	if (pass && check.md5.isEmpty())
+	{
+		QFile entryFile(realEntryPath);
+		QCryptographicHash hash(QCryptographicHash::Md5);
+		if (!entryFile.open(QFile::ReadOnly) || !hash.addData(&entryFile))
+		{
+			QLOG_ERROR() << "File " << realEntryPath << " cannot be opened for reading.";
+			pass = false;
+		}
+		else
+		{
+			check.md5 = hash.result().toHex();
+			QMutexLocker locker(&hashCacheLock);
+			hashCache.insert(realEntryPath,
+							 HashCacheEntry{entryInfo.size(), entryInfo.lastModified(), check.md5});
+		}
+	}
+	if (!pass)
+	{
+		QLOG_ERROR() << "ROOT: " << MMC->root();
+		check.result = FileCheck::Unusable;
+		return check;
 	}
 
+	if (check.md5 != entry.md5)
+	{
+		QLOG_DEBUG() << "MD5Sum does not match!";
+		QLOG_DEBUG() << "Expected:'" << entry.md5 << "'";
+		QLOG_DEBUG() << "Got:     '" << check.md5 << "'";
+		check.result = FileCheck::Changed;
+	}
+	else
+	{
+		QLOG_DEBUG() << "File" << realEntryPath << " does not need updating.";
+		check.result = FileCheck::Unchanged;
+	}
+	return check;
+}
+
+void DownloadUpdateTask::processFileLists()
+{
+	// Create a network job for downloading files. It starts right away, and the files are added
+	// as the installed files are checked.
+	NetJob *netJob = new NetJob("Update Files");
+	netJob->setExpectingMore(true);
+
 	// Add listeners to wait for the downloads to finish.
 	QObject::connect(netJob, &NetJob::succeeded, this,
 					 &DownloadUpdateTask::fileDownloadFinished);
@@ -272,24 +371,62 @@ void DownloadUpdateTask::processFileLists()
 					 &DownloadUpdateTask::fileDownloadProgressChanged);
 	QObject::connect(netJob, &NetJob::failed, this, &DownloadUpdateTask::fileDownloadFailed);
 
-	// Now start the download.
-	setStatus(tr("Downloading %1 update files.").arg(QString::number(netJob->size())));
+	setStatus(tr("Processing file lists - figuring out how to install the update..."));
+	processDeletions(m_cVersionFileList, m_nVersionFileList, m_operationList);
+
 	QLOG_DEBUG() << "Begin downloading update files to" << m_updateFilesDir.path();
 	m_filesNetJob.reset(netJob);
 	netJob->start();
 
-	writeInstallScript(m_operationList, PathCombine(m_updateFilesDir.path(), "file_list.xml"));
+	// Hash the installed files in the background.
+	m_checkFailed = false;
+	m_checkWatcher.setFuture(QtConcurrent::mapped(m_nVersionFileList, &checkInstalledFile));
 }
 
-bool
-DownloadUpdateTask::processFileLists(NetJob *job,
-									 const DownloadUpdateTask::VersionFileList &currentVersion,
-									 const DownloadUpdateTask::VersionFileList &newVersion,
-									 DownloadUpdateTask::UpdateOperationList &ops)
+void DownloadUpdateTask::fileChecked(int index)
 {
-	setStatus(tr("Processing file lists - figuring out how to install the update..."));
+	if (m_checkFailed)
+		return;
+	FileCheck check = m_checkWatcher.resultAt(index);
+	if (check.result == FileCheck::Unusable)
+	{
+		m_checkFailed = true;
+		m_checkWatcher.cancel();
+		return;
+	}
+	if (check.result == FileCheck::Unchanged)
+		return;
 
-	// First, if we've loaded the current version's file list, we need to iterate through it and
+	// Start downloading this one while the others are still being checked.
+	addFileDownloads(m_filesNetJob.get(), m_nVersionFileList[index], check.md5, m_operationList);
+}
+
+void DownloadUpdateTask::filesChecked()
+{
+	if (m_checkFailed)
+	{
+		// Let whatever was started finish quietly, none of it will be installed.
+		// The job has to be told nothing else is coming, or it never finishes and keeps
+		// its place in the bandwidth budget.
+		QObject::disconnect(m_filesNetJob.get(), 0, this, 0);
+		m_filesNetJob->setExpectingMore(false);
+		m_operationList.clear();
+		emitFailed(tr("Failed to process update lists..."));
+		return;
+	}
+
+	setStatus(tr("Downloading %1 update files.").arg(QString::number(m_filesNetJob->size())));
+	writeInstallScript(m_operationList, PathCombine(m_updateFilesDir.path(), "file_list.xml"));
+
+	// That's all of them. The job finishes when they're downloaded.
+	m_filesNetJob->setExpectingMore(false);
+}
+
+void DownloadUpdateTask::processDeletions(const VersionFileList &currentVersion,
+										  const VersionFileList &newVersion,
+										  UpdateOperationList &ops)
+{
+	// If we've loaded the current version's file list, we need to iterate through it and
 	// delete anything in the current one version's list that isn't in the new version's list.
 	for (VersionFileEntry entry : currentVersion)
 	{
@@ -320,120 +457,118 @@ DownloadUpdateTask::processFileLists(NetJob *job,
 				ops.append(UpdateOperation::DeleteOp(entry.path));
 		}
 	}
+}
+
+bool
+DownloadUpdateTask::processFileLists(NetJob *job,
+									 const DownloadUpdateTask::VersionFileList &currentVersion,
+									 const DownloadUpdateTask::VersionFileList &newVersion,
+									 DownloadUpdateTask::UpdateOperationList &ops)
+{
+	setStatus(tr("Processing file lists - figuring out how to install the update..."));
+
+	// First, delete what isn't in the new version any more.
+	processDeletions(currentVersion, newVersion, ops);
 
 	// Next, check each file in MultiMC's folder and see if we need to update them.
-	for (VersionFileEntry entry : newVersion)
+	auto checks = QtConcurrent::blockingMapped<QList<FileCheck>>(newVersion, &checkInstalledFile);
+	for (int i = 0; i < newVersion.size(); i++)
 	{
-		// TODO: Let's not MD5sum a ton of files on the GUI thread. We should probably find a
-		// way to do this in the background.
-		QString fileMD5;
-		QString realEntryPath = PathCombine(MMC->root(), entry.path);
-		QFile entryFile(realEntryPath);
-		QFileInfo entryInfo(realEntryPath);
-
-		bool needs_upgrade = false;
-		if (!entryFile.exists())
+		if (checks[i].result == FileCheck::Unusable)
 		{
-			needs_upgrade = true;
+			ops.clear();
+			return false;
 		}
-		else
-		{
-			bool pass = true;
-			if (!entryInfo.isReadable())
-			{
-				QLOG_ERROR() << "File " << realEntryPath << " is not readable.";
-				pass = false;
-			}
-			if (!entryInfo.isWritable())
-			{
-				QLOG_ERROR() << "File " << realEntryPath << " is not writable.";
-				pass = false;
-			}
-			if (!entryFile.open(QFile::ReadOnly))
-			{
-				QLOG_ERROR() << "File " << realEntryPath << " cannot be opened for reading.";
-				pass = false;
-			}
-			if (!pass)
-			{
-				QLOG_ERROR() << "ROOT: " << MMC->root();
-				ops.clear();
-				return false;
-			}
-		}
-
-		if(!needs_upgrade)
-		{
-			QCryptographicHash hash(QCryptographicHash::Md5);
-			auto foo = entryFile.readAll();
+		if (checks[i].result != FileCheck::Unchanged)
+			addFileDownloads(job, newVersion[i], checks[i].md5, ops);
+	}
+	return true;
+}
 
-			hash.addData(foo);
-			fileMD5 = hash.result().toHex();
-			if ((fileMD5 != entry.md5))
-			{
-				QLOG_DEBUG() << "MD5Sum does not match!";
-				QLOG_DEBUG() << "Expected:'" << entry.md5 << "'";
-				QLOG_DEBUG() << "Got:     '" << fileMD5 << "'";
-				needs_upgrade = true;
-			}
-		}
+void DownloadUpdateTask::addFileDownloads(NetJob *job, const VersionFileEntry &entry,
+										  const QString &installedMD5, UpdateOperationList &ops)
+{
+	QString realEntryPath = PathCombine(MMC->root(), entry.path);
 
-		// skip file. it doesn't need an upgrade.
-		if (!needs_upgrade)
-		{
-			QLOG_DEBUG() << "File" << realEntryPath << " does not need updating.";
-			continue;
-		}
+	// yep. this file actually needs an upgrade. PROCEED.
+	QLOG_DEBUG() << "Found file" << realEntryPath << " that needs updating.";
 
-		// yep. this file actually needs an upgrade. PROCEED.
-		QLOG_DEBUG() << "Found file" << realEntryPath << " that needs updating.";
+	// if it's the updater we want to treat it separately
+	bool isUpdater = entry.path.endsWith("updater") || entry.path.endsWith("updater.exe");
 
-		// if it's the updater we want to treat it separately
-		bool isUpdater = entry.path.endsWith("updater") || entry.path.endsWith("updater.exe");
+	// If there's a patch for the version we have, download that instead of the whole file.
+	// The updater goes through the cache, so it is always downloaded whole.
+	if (!isUpdater && !installedMD5.isEmpty() && addPatchDownload(job, entry, installedMD5, ops))
+	{
+		return;
+	}
 
-		// Go through the sources list and find one to use.
-		// TODO: Make a NetAction that takes a source list and tries each of them until one
-		// works. For now, we'll just use the first http one.
-		for (FileSource source : entry.sources)
+	// Go through the sources list and find one to use.
+	// TODO: Make a NetAction that takes a source list and tries each of them until one
+	// works. For now, we'll just use the first http one.
+	for (FileSource source : entry.sources)
+	{
+		if (source.type == "http")
 		{
-			if (source.type == "http")
-			{
-				QLOG_DEBUG() << "Will download" << entry.path << "from" << source.url;
+			QLOG_DEBUG() << "Will download" << entry.path << "from" << source.url;
 
-				// Download it to updatedir/<filepath>-<md5> where filepath is the file's
-				// path with slashes replaced by underscores.
-				QString dlPath =
-					PathCombine(m_updateFilesDir.path(), QString(entry.path).replace("/", "_"));
+			// Download it to updatedir/<filepath>-<md5> where filepath is the file's
+			// path with slashes replaced by underscores.
+			QString dlPath =
+				PathCombine(m_updateFilesDir.path(), QString(entry.path).replace("/", "_"));
 
-				if (isUpdater)
+			if (isUpdater)
+			{
+				if(BuildConfig.UPDATER_FORCE_LOCAL)
 				{
-					if(BuildConfig.UPDATER_FORCE_LOCAL)
-					{
-						QLOG_DEBUG() << "Skipping updater download and using local version.";
-					}
-					else
-					{
-						auto cache_entry = MMC->metacache()->resolveEntry("root", entry.path);
-						QLOG_DEBUG() << "Updater will be in " << cache_entry->getFullPath();
-						// force check.
-						cache_entry->stale = true;
-
-						auto download = CacheDownload::make(QUrl(source.url), cache_entry);
-						job->addNetAction(download);
-					}
+					QLOG_DEBUG() << "Skipping updater download and using local version.";
 				}
 				else
 				{
-					// We need to download the file to the updatefiles folder and add a task
-					// to copy it to its install path.
-					auto download = MD5EtagDownload::make(source.url, dlPath);
-					download->m_expected_md5 = entry.md5;
+					auto cache_entry = MMC->metacache()->resolveEntry("root", entry.path);
+					QLOG_DEBUG() << "Updater will be in " << cache_entry->getFullPath();
+					// force check.
+					cache_entry->stale = true;
+
+					auto download = CacheDownload::make(QUrl(source.url), cache_entry);
 					job->addNetAction(download);
-					ops.append(UpdateOperation::CopyOp(dlPath, entry.path, entry.mode));
 				}
 			}
+			else
+			{
+				// We need to download the file to the updatefiles folder and add a task
+				// to copy it to its install path.
+				auto download = MD5EtagDownload::make(source.url, dlPath);
+				download->m_expected_md5 = entry.md5;
+				job->addNetAction(download);
+				ops.append(UpdateOperation::CopyOp(dlPath, entry.path, entry.mode));
+			}
 		}
 	}
+}
+
+bool DownloadUpdateTask::addPatchDownload(NetJob *job, const VersionFileEntry &entry,
+										  const QString &installedMD5, UpdateOperationList &ops)
+{
+	QString patchUrl;
+	QString fallbackUrl;
+	for (FileSource source : entry.sources)
+	{
+		if (source.type == "patch" && source.baseMD5 == installedMD5 && patchUrl.isEmpty())
+			patchUrl = source.url;
+		else if (source.type == "http" && fallbackUrl.isEmpty())
+			fallbackUrl = source.url;
+	}
+	if (patchUrl.isEmpty())
+		return false;
+
+	QLOG_DEBUG() << "Will patch" << entry.path << "with" << patchUrl;
+	QString dlPath = PathCombine(m_updateFilesDir.path(), QString(entry.path).replace("/", "_"));
+	auto download = MD5EtagDownload::make(patchUrl, dlPath + ".patch");
+	job->addNetAction(download);
+	m_patches.append(PatchEntry{PathCombine(MMC->root(), entry.path), dlPath + ".patch", dlPath,
+								entry.md5, fallbackUrl, download});
+	ops.append(UpdateOperation::CopyOp(dlPath, entry.path, entry.mode));
 	return true;
 }
 
@@ -527,16 +662,144 @@ bool DownloadUpdateTask::fixPathForOSX(QString &path)
 
 void DownloadUpdateTask::fileDownloadFinished()
 {
+	if (!m_patches.isEmpty())
+	{
+		applyPatches();
+		return;
+	}
 	emitSucceeded();
 }
 
 void DownloadUpdateTask::fileDownloadFailed()
 {
+	// Patches that failed to download are replaced by whole files later. Anything else is fatal.
+	bool onlyPatchesFailed = !m_patches.isEmpty();
+	for (int i = 0; i < m_filesNetJob->size() && onlyPatchesFailed; i++)
+	{
+		auto action = m_filesNetJob->at(i);
+		if (action->m_status != Job_Failed)
+			continue;
+		onlyPatchesFailed = false;
+		for (auto &patch : m_patches)
+		{
+			if (patch.download == action)
+			{
+				onlyPatchesFailed = true;
+				break;
+			}
+		}
+	}
+	if (onlyPatchesFailed)
+	{
+		applyPatches();
+		return;
+	}
+
 	// TODO: Give more info about the failure.
 	QLOG_ERROR() << "Failed to download update files.";
 	emitFailed(tr("Failed to download update files."));
 }
 
+namespace
+{
+DownloadUpdateTask::PatchEntryList applyPatchList(DownloadUpdateTask::PatchEntryList patches)
+{
+	DownloadUpdateTask::PatchEntryList failed;
+	for (auto &patch : patches)
+	{
+		QString error;
+		QFile patchFile(patch.patchPath);
+		QFile baseFile(patch.basePath);
+		QByteArray result;
+		if (patch.download->m_status == Job_Failed)
+		{
+			error = "the patch couldn't be downloaded";
+		}
+		else if (!patchFile.open(QIODevice::ReadOnly) || !baseFile.open(QIODevice::ReadOnly))
+		{
+			error = "the files can't be opened";
+		}
+		else if (BinaryPatch::apply(baseFile.readAll(), patchFile.readAll(), result, &error))
+		{
+			// only a file that is exactly what the new version has may be installed
+			QString md5 = QCryptographicHash::hash(result, QCryptographicHash::Md5).toHex();
+			if (md5 != patch.md5)
+			{
+				error = QString("the result has the MD5 %1 instead of %2").arg(md5, patch.md5);
+			}
+			else
+			{
+				QFile target(patch.targetPath);
+				if (!target.open(QIODevice::WriteOnly) || target.write(result) != result.size())
+					error = "the result can't be written";
+			}
+		}
+		patchFile.close();
+		patchFile.remove();
+		if (!error.isEmpty())
+		{
+			QLOG_WARN() << "Couldn't patch" << patch.basePath << ":" << error;
+			QFile::remove(patch.targetPath);
+			failed.append(patch);
+		}
+	}
+	return failed;
+}
+}
+
+void DownloadUpdateTask::applyPatches()
+{
+	setStatus(tr("Applying %1 patches...").arg(m_patches.size()));
+	m_patchWatcher.setFuture(QtConcurrent::run(applyPatchList, m_patches));
+}
+
+void DownloadUpdateTask::patchesApplied()
+{
+	auto failed = m_patchWatcher.result();
+	if (failed.isEmpty())
+	{
+		emitSucceeded();
+		return;
+	}
+
+	// Download the files that couldn't be patched whole.
+	NetJob *netJob = new NetJob("Update Files (fallback)");
+	for (auto &patch : failed)
+	{
+		if (patch.fallbackUrl.isEmpty())
+		{
+			delete netJob;
+			emitFailed(tr("Failed to patch %1, and there is no other way to get it.")
+						   .arg(patch.basePath));
+			return;
+		}
+		auto download = MD5EtagDownload::make(patch.fallbackUrl, patch.targetPath);
+		download->m_expected_md5 = patch.md5;
+		netJob->addNetAction(download);
+	}
+	QObject::connect(netJob, &NetJob::succeeded, this,
+					 &DownloadUpdateTask::fallbackDownloadFinished);
+	QObject::connect(netJob, &NetJob::progress, this,
+					 &DownloadUpdateTask::fileDownloadProgressChanged);
+	QObject::connect(netJob, &NetJob::failed, this, &DownloadUpdateTask::fallbackDownloadFailed);
+
+	setStatus(tr("Downloading %1 update files that couldn't be patched.")
+				  .arg(QString::number(netJob->size())));
+	m_fallbackNetJob.reset(netJob);
+	netJob->start();
+}
+
+void DownloadUpdateTask::fallbackDownloadFinished()
+{
+	emitSucceeded();
+}
+
+void DownloadUpdateTask::fallbackDownloadFailed()
+{
+	QLOG_ERROR() << "Failed to download update files that couldn't be patched.";
+	emitFailed(tr("Failed to download update files."));
+}
+
 void DownloadUpdateTask::fileDownloadProgressChanged(qint64 current, qint64 total)
 {
 	setProgress((int)(((float)current / (float)total) * 100));
@@ -18,6 +18,8 @@
 #include "logic/tasks/Task.h"
 #include "logic/net/NetJob.h"
 
+#include <QFutureWatcher>
+
 /*!
  * The DownloadUpdateTask is a task that takes a given version ID and repository URL,
  * downloads that version's files from the repository, and prepares to install them.
@@ -43,16 +45,20 @@ public:
 	 */
 	struct FileSource
 	{
-		FileSource(QString type, QString url, QString compression="")
+		FileSource(QString type, QString url, QString compression="", QString baseMD5="")
 		{
 			this->type = type;
 			this->url = url;
 			this->compressionType = compression;
+			this->baseMD5 = baseMD5;
 		}
 
 		QString type;
 		QString url;
 		QString compressionType;
+
+		//! For patches, the MD5 of the file the patch applies to.
+		QString baseMD5;
 	};
 	typedef QList<FileSource> FileSourceList;
 
@@ -100,6 +106,44 @@ public:
 	};
 	typedef QList<UpdateOperation> UpdateOperationList;
 
+	/*!
+	 * A file that is updated by patching the installed version instead of downloading it whole.
+	 */
+	struct PatchEntry
+	{
+		//! The installed file the patch applies to.
+		QString basePath;
+		//! Where the patch is downloaded to.
+		QString patchPath;
+		//! Where the patched file goes, in the update files directory.
+		QString targetPath;
+		//! MD5 of the patched file.
+		QString md5;
+		//! URL of the whole file, used if patching doesn't work out. May be empty.
+		QString fallbackUrl;
+		//! The download of the patch.
+		NetActionPtr download;
+	};
+	typedef QList<PatchEntry> PatchEntryList;
+
+	/*!
+	 * What checking an installed file against the new version's entry found.
+	 */
+	struct FileCheck
+	{
+		enum Result
+		{
+			Unchanged,
+			Changed,
+			Missing,
+			//! The file exists, but can't be read or replaced.
+			Unusable,
+		} result = Unchanged;
+
+		//! MD5 of the installed file, if it exists.
+		QString md5;
+	};
+
 protected:
 	friend class DownloadUpdateTaskTest;
 
@@ -152,18 +196,53 @@ protected:
 	 */
 	virtual bool parseVersionInfo(const QByteArray &data, VersionFileList* list, QString *error);
 
+	/*!
+	 * Hashes the installed version of the entry's file and compares it with the entry.
+	 * Hashes are remembered by path, size and modification time, so it is only read once.
+	 * Runs on worker threads.
+	 */
+	static FileCheck checkInstalledFile(const VersionFileEntry &entry);
+
+	/*!
+	 * Adds delete operations for the files that are in the current version but not in the new one.
+	 */
+	void processDeletions(const VersionFileList &currentVersion, const VersionFileList &newVersion,
+						  UpdateOperationList &ops);
+
+	/*!
+	 * Adds the downloads for a file that needs updating to the job, and its install operation.
+	 */
+	virtual void addFileDownloads(NetJob *job, const VersionFileEntry &entry,
+								  const QString &installedMD5, UpdateOperationList &ops);
+
 	/*!
 	 * Takes a list of file entries for the current version's files and the new version's files
 	 * and populates the downloadList and operationList with information about how to download and install the update.
+	 * The installed files are hashed in parallel, but this blocks until they are all done.
 	 */
 	virtual bool processFileLists(NetJob *job, const VersionFileList &currentVersion, const VersionFileList &newVersion, UpdateOperationList &ops);
 
 	/*!
-	 * Calls \see processFileLists to populate the \see m_operationList and a NetJob, and then executes
-	 * the NetJob to fetch all needed files
+	 * Populates the \see m_operationList and a NetJob, and executes the NetJob to fetch all needed
+	 * files. The installed files are hashed in the background, and each changed file starts
+	 * downloading as soon as it is found.
 	 */
 	virtual void processFileLists();
 
+	/*!
+	 * If one of the entry's sources is a patch against the installed file, adds its download to
+	 * the job and the copy of the patched file to the operations list.
+	 * Returns false if there is no patch for the installed file.
+	 */
+	virtual bool addPatchDownload(NetJob *job, const VersionFileEntry &entry,
+								  const QString &installedMD5, UpdateOperationList &ops);
+
+	/*!
+	 * Applies the downloaded patches in the update files directory, in the background.
+	 * Files that can't be patched are downloaded whole afterwards.
+	 */
+	virtual void applyPatches();
+
 	/*!
 	 * Takes the operations list and writes an install script for the updater to the update files directory.
 	 */
@@ -180,6 +259,19 @@ protected:
 	//! Network job for downloading update files.
 	NetJobPtr m_filesNetJob;
 
+	//! Checks the installed files against the new version's list.
+	QFutureWatcher<FileCheck> m_checkWatcher;
+	bool m_checkFailed = false;
+
+	//! Files updated with patches. Filled by processFileLists.
+	PatchEntryList m_patches;
+
+	//! Applies the patches. The result is the list of files that couldn't be patched.
+	QFutureWatcher<PatchEntryList> m_patchWatcher;
+
+	//! Network job for downloading the files that couldn't be patched.
+	NetJobPtr m_fallbackNetJob;
+
 	// Version ID and repo URL for the new version.
 	int m_nVersionId;
 	QString m_nRepoUrl;
@@ -210,8 +302,16 @@ protected slots:
 	void vinfoDownloadFinished();
 	void vinfoDownloadFailed();
 
+	void fileChecked(int index);
+	void filesChecked();
+
 	void fileDownloadFinished();
 	void fileDownloadFailed();
 	void fileDownloadProgressChanged(qint64 current, qint64 total);
+
+	void patchesApplied();
+
+	void fallbackDownloadFinished();
+	void fallbackDownloadFailed();
 };
 
@@ -7,6 +7,8 @@
 #include "MultiMC.h"
 #include "BuildConfig.h"
 #include "logic/net/CacheDownload.h"
+#include "logic/MMCJson.h"
+#include "logger/QsLog.h"
 
 NotificationChecker::NotificationChecker(QObject *parent)
 	: QObject(parent), m_notificationsUrl(QUrl(BuildConfig.NOTIFICATION_URL))
@@ -43,6 +45,7 @@ void NotificationChecker::checkForNotifications()
 		return;
 	}
 	m_checkJob.reset(new NetJob("Checking for notifications"));
+	m_checkJob->setPriority(Priority_Background);
 	auto entry = MMC->metacache()->resolveEntry("root", "notifications.json");
 	entry->stale = true;
 	m_checkJob->addNetAction(m_download = CacheDownload::make(m_notificationsUrl, entry));
@@ -55,35 +58,39 @@ void NotificationChecker::downloadSucceeded(int)
 {
 	m_entries.clear();
 
-	QFile file(m_download->getTargetFilepath());
-	if (file.open(QFile::ReadOnly))
+	QJsonArray root;
+	try
 	{
-		QJsonArray root = QJsonDocument::fromJson(file.readAll()).array();
-		for (auto it = root.begin(); it != root.end(); ++it)
+		root = MMCJson::parseFile(m_download->getTargetFilepath(), "notifications.json").array();
+	}
+	catch (MMCError &e)
+	{
+		QLOG_WARN() << e.cause();
+	}
+	for (auto it = root.begin(); it != root.end(); ++it)
+	{
+		QJsonObject obj = (*it).toObject();
+		NotificationEntry entry;
+		entry.id = obj.value("id").toDouble();
+		entry.message = obj.value("message").toString();
+		entry.channel = obj.value("channel").toString();
+		entry.platform = obj.value("platform").toString();
+		entry.from = obj.value("from").toString();
+		entry.to = obj.value("to").toString();
+		const QString type = obj.value("type").toString("critical");
+		if (type == "critical")
+		{
+			entry.type = NotificationEntry::Critical;
+		}
+		else if (type == "warning")
+		{
+			entry.type = NotificationEntry::Warning;
+		}
+		else if (type == "information")
 		{
-			QJsonObject obj = (*it).toObject();
-			NotificationEntry entry;
-			entry.id = obj.value("id").toDouble();
-			entry.message = obj.value("message").toString();
-			entry.channel = obj.value("channel").toString();
-			entry.platform = obj.value("platform").toString();
-			entry.from = obj.value("from").toString();
-			entry.to = obj.value("to").toString();
-			const QString type = obj.value("type").toString("critical");
-			if (type == "critical")
-			{
-				entry.type = NotificationEntry::Critical;
-			}
-			else if (type == "warning")
-			{
-				entry.type = NotificationEntry::Warning;
-			}
-			else if (type == "information")
-			{
-				entry.type = NotificationEntry::Information;
-			}
-			m_entries.append(entry);
+			entry.type = NotificationEntry::Information;
 		}
+		m_entries.append(entry);
 	}
 
 	m_checkJob.reset();
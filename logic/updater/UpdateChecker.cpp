@@ -93,6 +93,7 @@ void UpdateChecker::checkForUpdate(bool notifyNoUpdate)
 	QUrl indexUrl = QUrl(m_repoUrl).resolved(QUrl("index.json"));
 
 	auto job = new NetJob("GoUpdate Repository Index");
+	job->setPriority(Priority_Background);
 	job->addNetAction(ByteArrayDownload::make(indexUrl));
 	connect(job, &NetJob::succeeded, [this, notifyNoUpdate]()
 	{ updateCheckFinished(notifyNoUpdate); });
@@ -184,6 +185,7 @@ void UpdateChecker::updateChanList(bool notifyNoUpdate)
 
 	m_chanListLoading = true;
 	NetJob *job = new NetJob("Update System Channel List");
+	job->setPriority(Priority_Background);
 	job->addNetAction(ByteArrayDownload::make(QUrl(m_channelListUrl)));
 	connect(job, &NetJob::succeeded, [this, notifyNoUpdate]()
 	{ chanListDownloadFinished(notifyNoUpdate); });
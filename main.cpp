@@ -1,5 +1,10 @@
 #include "MultiMC.h"
 #include "gui/MainWindow.h"
+#include "logic/CacheWarmer.h"
+#include "logic/CacheCollector.h"
+#include "logic/assets/AssetsScanTask.h"
+
+#include <iostream>
 
 int main_gui(MultiMC &app)
 {
@@ -15,6 +20,69 @@ int main_gui(MultiMC &app)
 	return app.exec();
 }
 
+int main_warm_cache(MultiMC &app)
+{
+	CacheWarmer warmer;
+	QObject::connect(&warmer, &CacheWarmer::succeeded, [&]()
+	{
+		std::cout << qPrintable(warmer.summary()) << std::endl;
+		app.exit(0);
+	});
+	QObject::connect(&warmer, &CacheWarmer::failed, [&](QString)
+	{
+		std::cout << qPrintable(warmer.summary()) << std::endl;
+		app.exit(1);
+	});
+	QObject::connect(&warmer, &CacheWarmer::status, [](QString status)
+	{
+		std::cout << qPrintable(status) << std::endl;
+	});
+	warmer.start();
+	return app.exec();
+}
+
+int main_collect_cache(MultiMC &app)
+{
+	CacheCollector collector(app.dryRunMode());
+	QObject::connect(&collector, &CacheCollector::succeeded, [&]()
+	{
+		std::cout << qPrintable(collector.summary()) << std::endl;
+		app.exit(0);
+	});
+	QObject::connect(&collector, &CacheCollector::failed, [&](QString reason)
+	{
+		std::cout << qPrintable(reason) << std::endl;
+		app.exit(1);
+	});
+	QObject::connect(&collector, &CacheCollector::status, [](QString status)
+	{
+		std::cout << qPrintable(status) << std::endl;
+	});
+	collector.start();
+	return app.exec();
+}
+
+int main_scan_assets(MultiMC &app)
+{
+	AssetsScanTask scanner(!app.dryRunMode());
+	QObject::connect(&scanner, &AssetsScanTask::succeeded, [&]()
+	{
+		std::cout << qPrintable(scanner.summary()) << std::endl;
+		app.exit(0);
+	});
+	QObject::connect(&scanner, &AssetsScanTask::failed, [&](QString reason)
+	{
+		std::cout << qPrintable(reason) << std::endl;
+		app.exit(1);
+	});
+	QObject::connect(&scanner, &AssetsScanTask::status, [](QString status)
+	{
+		std::cout << qPrintable(status) << std::endl;
+	});
+	scanner.start();
+	return app.exec();
+}
+
 int main(int argc, char *argv[])
 {
 	// initialize Qt
@@ -35,6 +103,12 @@ int main(int argc, char *argv[])
 	switch (app.status())
 	{
 	case MultiMC::Initialized:
+		if (app.warmCacheMode())
+			return main_warm_cache(app);
+		if (app.collectCacheMode())
+			return main_collect_cache(app);
+		if (app.scanAssetsMode())
+			return main_scan_assets(app);
 		return main_gui(app);
 	case MultiMC::Failed:
 		return 1;
@@ -0,0 +1,87 @@
+#include <QTest>
+#include <QTemporaryDir>
+#include "TestUtil.h"
+
+#include "logic/assets/AssetsUtils.h"
+#include "depends/util/include/pathutils.h"
+
+static const char *indexJson =
+	"{\"virtual\": true, \"objects\": {\n"
+	"  \"icons/icon_16x16.png\": {\"hash\": \"bdf48ef6b5d0d23bbb02e17d04865216179f510a\", "
+	"\"size\": 3665},\n"
+	"  \"sounds/caf\\u00e9.ogg\": {\"size\": 12, \"hash\": "
+	"\"0123456789ABCDEF0123456789abcdef01234567\", \"extra\": [1, {\"a\": null}]}\n"
+	"}}";
+
+class AssetsUtilsTest : public QObject
+{
+	Q_OBJECT
+private:
+	void checkIndex(const AssetsIndex &index)
+	{
+		QVERIFY(index.isVirtual);
+		QCOMPARE(index.objects.size(), 2);
+		QCOMPARE(index.name(index.objects[0]), QString("icons/icon_16x16.png"));
+		QCOMPARE(index.objects[0].hash(), QString("bdf48ef6b5d0d23bbb02e17d04865216179f510a"));
+		QCOMPARE(index.objects[0].size, qint64(3665));
+		QCOMPARE(index.name(index.objects[1]), QString::fromUtf8("sounds/caf\xc3\xa9.ogg"));
+		QCOMPARE(index.objects[1].hash(), QString("0123456789abcdef0123456789abcdef01234567"));
+		QCOMPARE(index.objects[1].size, qint64(12));
+	}
+
+private
+slots:
+	void test_parse()
+	{
+		AssetsIndex index;
+		QByteArray data(indexJson);
+		QVERIFY(AssetsUtils::parseAssetsIndex(data.constData(), data.size(), &index));
+		checkIndex(index);
+	}
+
+	void test_parseBroken()
+	{
+		QList<QByteArray> broken = {
+			"", "{\"objects\": {", "{\"objects\": {\"a\": {\"size\": 1}}}",
+			"{\"objects\": {\"a\": {\"hash\": \"abc\"}}}", "{\"objects\": {}} trailing"};
+		for (auto data : broken)
+		{
+			AssetsIndex index;
+			QVERIFY2(!AssetsUtils::parseAssetsIndex(data.constData(), data.size(), &index),
+					 data.constData());
+		}
+	}
+
+	void test_parsedCache()
+	{
+		QTemporaryDir dir;
+		QString path = PathCombine(dir.path(), "test.json");
+		QFile file(path);
+		QVERIFY(file.open(QIODevice::WriteOnly));
+		file.write(indexJson);
+		file.close();
+
+		AssetsIndex first;
+		QVERIFY(AssetsUtils::loadAssetsIndexJson(path, &first));
+		checkIndex(first);
+		QVERIFY(QFile::exists(PathCombine(dir.path(), "parsed", "test.bin")));
+
+		// comes from the parsed form this time
+		AssetsIndex second;
+		QVERIFY(AssetsUtils::loadAssetsIndexJson(path, &second));
+		checkIndex(second);
+
+		// a different index in the same place is parsed again
+		QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+		file.write("{\"objects\": {}}");
+		file.close();
+		AssetsIndex third;
+		QVERIFY(AssetsUtils::loadAssetsIndexJson(path, &third));
+		QVERIFY(!third.isVirtual);
+		QCOMPARE(third.objects.size(), 0);
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(AssetsUtilsTest)
+
+#include "tst_AssetsUtils.moc"
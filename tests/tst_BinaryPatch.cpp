@@ -0,0 +1,79 @@
+#include <QTest>
+#include <QDataStream>
+#include "TestUtil.h"
+
+#include "logic/updater/BinaryPatch.h"
+
+class BinaryPatchTest : public QObject
+{
+	Q_OBJECT
+private:
+	struct Block
+	{
+		QByteArray diff;
+		QByteArray extra;
+		qint64 seek;
+	};
+
+	QByteArray makePatch(qint64 newSize, QList<Block> blocks)
+	{
+		QByteArray body;
+		QDataStream out(&body, QIODevice::WriteOnly);
+		out.setByteOrder(QDataStream::BigEndian);
+		out << newSize;
+		for (auto block : blocks)
+		{
+			out << quint32(block.diff.size()) << quint32(block.extra.size()) << block.seek;
+			out.writeRawData(block.diff.constData(), block.diff.size());
+			out.writeRawData(block.extra.constData(), block.extra.size());
+		}
+		return "MMCPATCH" + qCompress(body);
+	}
+
+private
+slots:
+	void test_apply()
+	{
+		QByteArray old("Hello world, this is the old file.");
+		// "Hello" becomes "Jello" through the diff, then new text and a copy of "the old file."
+		QByteArray diff(5, 0);
+		diff[0] = 'J' - 'H';
+		QByteArray patch = makePatch(
+			5 + 10 + 13, {{diff, " new text!", 16}, {QByteArray(13, 0), QByteArray(), 0}});
+		QByteArray result;
+		QString error;
+		QVERIFY2(BinaryPatch::apply(old, patch, result, &error), qPrintable(error));
+		QCOMPARE(result, QByteArray("Jello new text!the old file."));
+	}
+
+	void test_rejectBadPatches()
+	{
+		QByteArray old("short");
+		QByteArray result;
+		QString error;
+		// no magic
+		QVERIFY(!BinaryPatch::apply(old, QByteArray("garbage"), result, &error));
+		// diff data past the end of the old file
+		QVERIFY(!BinaryPatch::apply(old, makePatch(10, {{QByteArray(10, 0), QByteArray(), 0}}),
+									result, &error));
+		// blocks that make more than the new size
+		QVERIFY(!BinaryPatch::apply(old, makePatch(2, {{QByteArray(), "abc", 0}}), result,
+									&error));
+		// not enough blocks
+		QVERIFY(!BinaryPatch::apply(old, makePatch(4, {{QByteArray(), "ab", 0}}), result,
+									&error));
+		// a new size that doesn't fit in memory, or in the patch
+		QVERIFY(!BinaryPatch::apply(old, makePatch(qint64(1) << 32, {{QByteArray(), "ab", 0}}),
+									result, &error));
+		QVERIFY(!BinaryPatch::apply(old, makePatch(100, {{QByteArray(), "ab", 0}}), result,
+									&error));
+		// seeking far outside the old file
+		QVERIFY(!BinaryPatch::apply(
+			old, makePatch(4, {{QByteArray(), "ab", qint64(1) << 62}, {QByteArray(), "cd", 0}}),
+			result, &error));
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(BinaryPatchTest)
+
+#include "tst_BinaryPatch.moc"
@@ -0,0 +1,116 @@
+#include <QTest>
+#include "TestUtil.h"
+
+#include <checksum.h>
+#include <zlib.h>
+
+namespace
+{
+// the byte-at-a-time loops xz-embedded had, as the reference
+struct ReferenceTables
+{
+	quint32 crc32[256];
+	quint64 crc64[256];
+	ReferenceTables()
+	{
+		for (int i = 0; i < 256; i++)
+		{
+			quint32 r = i;
+			quint64 q = i;
+			for (int j = 0; j < 8; j++)
+			{
+				r = (r >> 1) ^ (0xEDB88320 & ~((r & 1) - 1));
+				q = (q >> 1) ^ (Q_UINT64_C(0xC96C5795D7870F42) & ~((q & 1) - 1));
+			}
+			crc32[i] = r;
+			crc64[i] = q;
+		}
+	}
+};
+const ReferenceTables tables;
+
+quint32 referenceCrc32(quint32 crc, const uchar *buf, size_t len)
+{
+	crc = ~crc;
+	while (len--)
+		crc = tables.crc32[*buf++ ^ (crc & 0xFF)] ^ (crc >> 8);
+	return ~crc;
+}
+
+quint64 referenceCrc64(quint64 crc, const uchar *buf, size_t len)
+{
+	crc = ~crc;
+	while (len--)
+		crc = tables.crc64[*buf++ ^ (crc & 0xFF)] ^ (crc >> 8);
+	return ~crc;
+}
+
+// the same bytes on every run
+QByteArray corpus(int size)
+{
+	QByteArray data(size, 0);
+	quint32 state = 12345;
+	for (int i = 0; i < size; i++)
+	{
+		state = state * 1103515245 + 12345;
+		data[i] = char(state >> 16);
+	}
+	return data;
+}
+}
+
+class ChecksumTest : public QObject
+{
+	Q_OBJECT
+private
+slots:
+	void test_knownValues()
+	{
+		QCOMPARE(checksum_crc32(0, "123456789", 9), quint32(0xCBF43926));
+		QCOMPARE(quint64(checksum_crc64(0, "123456789", 9)), Q_UINT64_C(0x995DC9BBDF1939FA));
+		QCOMPARE(checksum_crc32(0, nullptr, 0), quint32(0));
+		QCOMPARE(quint64(checksum_crc64(0, nullptr, 0)), quint64(0));
+	}
+
+	// every length around the point the folding kicks in, at every alignment
+	void test_matchesTables()
+	{
+		QByteArray data = corpus(1200 + 16);
+		for (int offset = 0; offset < 16; offset++)
+		{
+			const uchar *buf = (const uchar *)data.constData() + offset;
+			for (int len = 0; len <= 1200; len++)
+			{
+				quint32 seed32 = len * 2654435761u;
+				quint64 seed64 = quint64(seed32) << 32 | len;
+				quint32 crc32 = referenceCrc32(seed32, buf, len);
+				quint64 crc64 = referenceCrc64(seed64, buf, len);
+				QCOMPARE(checksum_crc32(seed32, buf, len), crc32);
+				QCOMPARE(checksum_crc32_slice8(seed32, buf, len), crc32);
+				QCOMPARE(quint32(::crc32(seed32, buf, len)), crc32);
+				QCOMPARE(quint64(checksum_crc64(seed64, buf, len)), crc64);
+				QCOMPARE(quint64(checksum_crc64_slice8(seed64, buf, len)), crc64);
+			}
+		}
+	}
+
+	void test_chained()
+	{
+		QByteArray data = corpus(1 << 20);
+		const uchar *buf = (const uchar *)data.constData();
+		quint32 crc32 = referenceCrc32(0, buf, data.size());
+		quint64 crc64 = referenceCrc64(0, buf, data.size());
+		QCOMPARE(checksum_crc32(0, buf, data.size()), crc32);
+		QCOMPARE(quint64(checksum_crc64(0, buf, data.size())), crc64);
+		for (int cut : {1, 15, 63, 64, 65, 4096, 100000})
+		{
+			size_t rest = data.size() - cut;
+			QCOMPARE(checksum_crc32(checksum_crc32(0, buf, cut), buf + cut, rest), crc32);
+			QCOMPARE(quint64(checksum_crc64(checksum_crc64(0, buf, cut), buf + cut, rest)), crc64);
+		}
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(ChecksumTest)
+
+#include "tst_Checksum.moc"
@@ -0,0 +1,90 @@
+#include <QTest>
+#include <QTemporaryDir>
+#include <QBuffer>
+#include "TestUtil.h"
+
+#include "logic/net/DownloadSink.h"
+
+class DownloadSinkTest : public QObject
+{
+	Q_OBJECT
+private:
+	QByteArray makeData(int size)
+	{
+		QByteArray data(size, 0);
+		for (int i = 0; i < size; i++)
+			data[i] = char((i * 7) ^ (i >> 8));
+		return data;
+	}
+
+	// feed the sink until the source is empty, waiting for the writer when it's full
+	bool drain(DownloadSink &sink, QIODevice &source)
+	{
+		while (source.bytesAvailable())
+		{
+			if (!sink.readFrom(&source))
+				return false;
+			if (source.bytesAvailable())
+				QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+		}
+		return true;
+	}
+
+private
+slots:
+	void test_writeAndHash()
+	{
+		QTemporaryDir dir;
+		QByteArray data = makeData(1000 * 1000);
+		QBuffer source(&data);
+		source.open(QIODevice::ReadOnly);
+
+		QFile file(dir.path() + "/out");
+		QVERIFY(file.open(QIODevice::WriteOnly));
+		DownloadSink sink(QCryptographicHash::Md5);
+		sink.begin(&file);
+		QVERIFY(drain(sink, source));
+		QVERIFY(sink.finish());
+		file.close();
+
+		QCOMPARE(sink.result(), QCryptographicHash::hash(data, QCryptographicHash::Md5));
+		QCOMPARE(TestsInternal::readFile(file.fileName()), data);
+	}
+
+	void test_resumeAndRestart()
+	{
+		QTemporaryDir dir;
+		QByteArray head = makeData(100 * 1000);
+		QByteArray tail = makeData(50 * 1000);
+		QFile file(dir.path() + "/out");
+		QVERIFY(file.open(QIODevice::WriteOnly));
+		file.write(head);
+		file.close();
+
+		// the data already in the file is part of the hash
+		QVERIFY(file.open(QIODevice::ReadWrite));
+		DownloadSink sink(QCryptographicHash::Sha1);
+		sink.begin(&file, true);
+		QBuffer source(&tail);
+		source.open(QIODevice::ReadOnly);
+		QVERIFY(drain(sink, source));
+		QVERIFY(sink.finish());
+		file.close();
+		QCOMPARE(sink.result(), QCryptographicHash::hash(head + tail, QCryptographicHash::Sha1));
+
+		// starting over drops everything
+		QVERIFY(file.open(QIODevice::ReadWrite));
+		sink.begin(&file, true);
+		sink.restart();
+		source.seek(0);
+		QVERIFY(drain(sink, source));
+		QVERIFY(sink.finish());
+		file.close();
+		QCOMPARE(sink.result(), QCryptographicHash::hash(tail, QCryptographicHash::Sha1));
+		QCOMPARE(TestsInternal::readFile(file.fileName()), tail);
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(DownloadSinkTest)
+
+#include "tst_DownloadSink.moc"
@@ -0,0 +1,38 @@
+#include <QTest>
+#include "TestUtil.h"
+
+#include "logic/GZip.h"
+
+class GZipTest : public QObject
+{
+	Q_OBJECT
+private
+slots:
+	void test_roundTrip()
+	{
+		QByteArray data;
+		for (int i = 0; i < 100000; i++)
+			data.append(QByteArray::number(i % 1000)).append(',');
+		QByteArray compressed;
+		QVERIFY(GZip::zip(data, compressed));
+		QVERIFY(GZip::isCompressed(compressed));
+		QVERIFY(!GZip::isCompressed(data));
+		QVERIFY(compressed.size() < data.size());
+		QByteArray uncompressed;
+		QVERIFY(GZip::unzip(compressed, uncompressed));
+		QCOMPARE(uncompressed, data);
+	}
+
+	void test_truncated()
+	{
+		QByteArray compressed;
+		QVERIFY(GZip::zip(QByteArray("{\"builds\": []}"), compressed));
+		compressed.chop(4);
+		QByteArray uncompressed;
+		QVERIFY(!GZip::unzip(compressed, uncompressed));
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(GZipTest)
+
+#include "tst_GZip.moc"
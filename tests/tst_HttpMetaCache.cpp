@@ -0,0 +1,157 @@
+#include <QTest>
+#include <QTemporaryDir>
+#include <QDateTime>
+#include "TestUtil.h"
+
+#include "logic/net/HttpMetaCache.h"
+
+class HttpMetaCacheTest : public QObject
+{
+	Q_OBJECT
+private:
+	MetaEntryPtr makeEntry(HttpMetaCache &cache, QString path, QString md5)
+	{
+		auto entry = cache.resolveEntry("test", path);
+		entry->md5sum = md5;
+		entry->etag = "\"" + md5 + "\"";
+		entry->local_changed_timestamp = 1234;
+		entry->stale = false;
+		return entry;
+	}
+
+private
+slots:
+	void test_journalRoundTrip()
+	{
+		QTemporaryDir dir;
+		QString index = dir.path() + "/metacache";
+		{
+			HttpMetaCache cache(index);
+			cache.addBase("test", dir.path());
+			cache.Load();
+			QVERIFY(cache.updateEntry(makeEntry(cache, "a.jar", "aaaa")));
+			QVERIFY(cache.updateEntry(makeEntry(cache, "b.jar", "bbbb")));
+			// an update replaces the older record
+			QVERIFY(cache.updateEntry(makeEntry(cache, "a.jar", "cccc")));
+		}
+		HttpMetaCache cache(index);
+		cache.addBase("test", dir.path());
+		cache.Load();
+		auto a = cache.getEntry("test", "a.jar");
+		QVERIFY(a.get() != nullptr);
+		QCOMPARE(a->md5sum, QString("cccc"));
+		QCOMPARE(a->etag, QString("\"cccc\""));
+		QCOMPARE(a->local_changed_timestamp, qint64(1234));
+		QVERIFY(!a->stale);
+		QVERIFY(cache.getEntry("test", "b.jar").get() != nullptr);
+	}
+
+	void test_damagedTail()
+	{
+		QTemporaryDir dir;
+		QString index = dir.path() + "/metacache";
+		{
+			HttpMetaCache cache(index);
+			cache.addBase("test", dir.path());
+			cache.Load();
+			QVERIFY(cache.updateEntry(makeEntry(cache, "a.jar", "aaaa")));
+		}
+		qint64 goodSize = QFileInfo(index).size();
+		{
+			QFile file(index);
+			QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Append));
+			// length of a record that isn't there
+			file.write(QByteArray("\x00\x00\x01\x00\x12", 5));
+		}
+		HttpMetaCache cache(index);
+		cache.addBase("test", dir.path());
+		cache.Load();
+		QVERIFY(cache.getEntry("test", "a.jar").get() != nullptr);
+		QCOMPARE(QFileInfo(index).size(), goodSize);
+	}
+
+	void test_lastAccess()
+	{
+		QTemporaryDir dir;
+		QString index = dir.path() + "/metacache";
+		qint64 before = QDateTime::currentMSecsSinceEpoch();
+		qint64 recorded;
+		{
+			HttpMetaCache cache(index);
+			cache.addBase("test", dir.path());
+			cache.Load();
+			auto entry = makeEntry(cache, "a.jar", "aaaa");
+			QVERIFY(cache.updateEntry(entry));
+			recorded = entry->last_access;
+			QVERIFY(recorded >= before);
+		}
+		HttpMetaCache cache(index);
+		cache.addBase("test", dir.path());
+		cache.Load();
+		auto a = cache.getEntry("test", "a.jar");
+		QVERIFY(a.get() != nullptr);
+		QCOMPARE(a->last_access, recorded);
+	}
+
+	void test_evictEntry()
+	{
+		QTemporaryDir dir;
+		QString index = dir.path() + "/metacache";
+		{
+			QFile file(dir.path() + "/a.jar");
+			QVERIFY(file.open(QIODevice::WriteOnly));
+			file.write("aaaa");
+		}
+		{
+			HttpMetaCache cache(index);
+			cache.addBase("test", dir.path());
+			cache.Load();
+			auto entry = makeEntry(cache, "a.jar", "aaaa");
+			QVERIFY(cache.updateEntry(entry));
+			QCOMPARE(cache.entries("test").size(), 1);
+			QVERIFY(cache.evictEntry(entry));
+			QVERIFY(!QFile::exists(dir.path() + "/a.jar"));
+			QVERIFY(cache.entries("test").isEmpty());
+			// already gone
+			QVERIFY(!cache.evictEntry(entry));
+		}
+		HttpMetaCache cache(index);
+		cache.addBase("test", dir.path());
+		cache.Load();
+		QVERIFY(cache.getEntry("test", "a.jar").get() == nullptr);
+	}
+
+	void test_migrateV1()
+	{
+		QTemporaryDir dir;
+		QString index = dir.path() + "/metacache";
+		{
+			QFile file(index);
+			QVERIFY(file.open(QIODevice::WriteOnly));
+			file.write("{\"version\": \"1\", \"entries\": [{\"base\": \"test\", \"path\": \"a.jar\", "
+					   "\"md5sum\": \"aaaa\", \"etag\": \"\\\"aaaa\\\"\", "
+					   "\"last_changed_timestamp\": 1234}, {\"base\": \"unknown\", "
+					   "\"path\": \"b.jar\", \"md5sum\": \"bbbb\", \"etag\": \"\", "
+					   "\"last_changed_timestamp\": 0}]}");
+		}
+		{
+			HttpMetaCache cache(index);
+			cache.addBase("test", dir.path());
+			cache.Load();
+			QVERIFY(cache.getEntry("test", "a.jar").get() != nullptr);
+		}
+		QVERIFY(TestsInternal::readFile(index).startsWith("MMCMETA2"));
+
+		HttpMetaCache cache(index);
+		cache.addBase("test", dir.path());
+		cache.Load();
+		auto a = cache.getEntry("test", "a.jar");
+		QVERIFY(a.get() != nullptr);
+		QCOMPARE(a->md5sum, QString("aaaa"));
+		QCOMPARE(a->local_changed_timestamp, qint64(1234));
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(HttpMetaCacheTest)
+
+#include "tst_HttpMetaCache.moc"
@@ -0,0 +1,52 @@
+#include <QTest>
+#include <QSignalSpy>
+#include "TestUtil.h"
+
+#include "logic/tasks/ProgressAggregator.h"
+
+class ProgressAggregatorTest : public QObject
+{
+	Q_OBJECT
+private
+slots:
+	void test_coalesce()
+	{
+		ProgressAggregator aggregator;
+		QSignalSpy spy(&aggregator, SIGNAL(progress(qint64, qint64)));
+
+		// the first update goes out right away, the rest waits for the next frame
+		for (int i = 1; i <= 1000; i++)
+			aggregator.setProgress(i, 1000);
+		QCOMPARE(spy.count(), 1);
+		QCOMPARE(spy.at(0).at(0).toLongLong(), qint64(1));
+
+		aggregator.flush();
+		QCOMPARE(spy.count(), 2);
+		QCOMPARE(spy.at(1).at(0).toLongLong(), qint64(1000));
+
+		// nothing new, nothing to pass on
+		aggregator.flush();
+		QCOMPARE(spy.count(), 2);
+	}
+
+	void test_throughput()
+	{
+		ProgressAggregator aggregator;
+		aggregator.setProgress(0, 10000);
+		QCOMPARE(aggregator.secondsLeft(), qint64(-1));
+		QTest::qWait(300);
+		aggregator.setProgress(1000, 10000);
+		aggregator.flush();
+		QVERIFY(aggregator.throughput() > 0);
+		QVERIFY(aggregator.secondsLeft() > 0);
+
+		// starting over forgets the old speed
+		aggregator.setProgress(0, 10000);
+		aggregator.flush();
+		QCOMPARE(aggregator.throughput(), 0.0);
+	}
+};
+
+QTEST_GUILESS_MAIN_MULTIMC(ProgressAggregatorTest)
+
+#include "tst_ProgressAggregator.moc"
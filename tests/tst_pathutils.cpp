@@ -1,4 +1,5 @@
 #include <QTest>
+#include <QTemporaryDir>
 #include "TestUtil.h"
 
 #include "depends/util/include/pathutils.h"
@@ -67,6 +68,34 @@ slots:
 
 		QCOMPARE(PathCombine(path1, path2, path3), result);
 	}
+
+	void test_replaceFile()
+	{
+		QTemporaryDir dir;
+		QVERIFY(dir.isValid());
+		QString src = PathCombine(dir.path(), "file.part");
+		QString dst = PathCombine(dir.path(), "file");
+		QFile file(dst);
+		QVERIFY(file.open(QIODevice::WriteOnly));
+		file.write("old");
+		file.close();
+		file.setFileName(src);
+		QVERIFY(file.open(QIODevice::WriteOnly));
+		file.write("new");
+		file.close();
+
+		QVERIFY(replaceFile(src, dst));
+		QVERIFY(!QFile::exists(src));
+		file.setFileName(dst);
+		QVERIFY(file.open(QIODevice::ReadOnly));
+		QCOMPARE(file.readAll(), QByteArray("new"));
+		file.close();
+
+		// a failed replace leaves the old file alone
+		QVERIFY(!replaceFile(src, dst));
+		QVERIFY(file.open(QIODevice::ReadOnly));
+		QCOMPARE(file.readAll(), QByteArray("new"));
+	}
 };
 
 QTEST_GUILESS_MAIN_MULTIMC(PathUtilsTest)